@@ -0,0 +1,48 @@
+#include <map>
+#include <stack>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 20000);
+
+  bench::report("s21::vector reserve + push_back", bench::run([n] {
+                  s21::vector<int> v;
+                  v.reserve(n);
+                  for (std::size_t i = 0; i < n; i++) {
+                    v.push_back(static_cast<int>(i));
+                  }
+                  bench::keep(v);
+                }));
+  bench::report("s21::stack push", bench::run([n] {
+                  s21::stack<int> s;
+                  for (std::size_t i = 0; i < n; i++) {
+                    s.push(static_cast<int>(i));
+                  }
+                  bench::keep(s);
+                }));
+  bench::report("std::stack push", bench::run([n] {
+                  std::stack<int> s;
+                  for (std::size_t i = 0; i < n; i++) {
+                    s.push(static_cast<int>(i));
+                  }
+                  bench::keep(s);
+                }));
+  bench::report("s21::map insert", bench::run([n] {
+                  s21::map<int, int> m;
+                  for (std::size_t i = 0; i < n; i++) {
+                    m.insert(static_cast<int>(i), 0);
+                  }
+                  bench::keep(m);
+                }));
+  bench::report("std::map insert", bench::run([n] {
+                  std::map<int, int> m;
+                  for (std::size_t i = 0; i < n; i++) {
+                    m.insert({static_cast<int>(i), 0});
+                  }
+                  bench::keep(m);
+                }));
+  return 0;
+}
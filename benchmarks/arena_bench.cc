@@ -0,0 +1,39 @@
+#include "../containers.h"
+#include "bench.h"
+
+// Имитация обработчика запросов: на каждый запрос строятся несколько
+// маленьких контейнеров, которые уничтожаются в конце запроса.
+template <typename Alloc>
+void handle_request(const Alloc &alloc) {
+  using pair_alloc = typename std::allocator_traits<
+      Alloc>::template rebind_alloc<std::pair<const int, int>>;
+  s21::map<int, int, pair_alloc> index{pair_alloc(alloc)};
+  s21::list<int, Alloc> pending(alloc);
+  s21::vector<int, Alloc> scratch(alloc);
+  scratch.reserve(16);
+  for (int i = 0; i < 32; i++) {
+    index.insert(i * 7 % 32, i);
+    pending.push_back(i);
+  }
+  bench::keep(index);
+  bench::keep(pending);
+}
+
+int main(int argc, char **argv) {
+  std::size_t requests = bench::size_arg(argc, argv, 100000);
+
+  bench::report("std::allocator", bench::run([requests] {
+                  std::allocator<int> alloc;
+                  for (std::size_t r = 0; r < requests; r++) {
+                    handle_request(alloc);
+                  }
+                }));
+  bench::report("s21::arena_allocator + reset", bench::run([requests] {
+                  s21::arena_allocator<int> alloc;
+                  for (std::size_t r = 0; r < requests; r++) {
+                    handle_request(alloc);
+                    s21::arena::local().reset();
+                  }
+                }));
+  return 0;
+}
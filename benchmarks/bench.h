@@ -0,0 +1,49 @@
+#ifndef CONTAINERS_BENCH_H_
+#define CONTAINERS_BENCH_H_
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../tests/alloc_tracker.h"
+
+// Общие утилиты бенчмарков: замер времени и аллокаций одного прогона
+namespace bench {
+
+struct Result {
+  double seconds = 0;
+  alloc_tracker::AllocStats allocs;
+};
+
+template <typename F>
+Result run(F &&workload) {
+  Result result;
+  alloc_tracker::AllocScope scope;
+  auto start = std::chrono::steady_clock::now();
+  workload();
+  auto stop = std::chrono::steady_clock::now();
+  result.seconds = std::chrono::duration<double>(stop - start).count();
+  result.allocs = scope.stats();
+  return result;
+}
+
+inline void report(const char *name, const Result &result) {
+  std::printf("%-40s %10.3f ms %10zu allocs %14zu bytes %14zu peak\n", name,
+              result.seconds * 1e3, result.allocs.allocations,
+              result.allocs.bytes, result.allocs.peak_live_bytes);
+}
+
+// Размер нагрузки можно передать первым аргументом командной строки
+inline std::size_t size_arg(int argc, char **argv, std::size_t fallback) {
+  return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : fallback;
+}
+
+// Не дает компилятору выбросить результат вычислений
+template <typename T>
+inline void keep(const T &value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+}  // namespace bench
+
+#endif  // CONTAINERS_BENCH_H_
@@ -0,0 +1,82 @@
+#include <cstdint>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Упакованный s21::vector<bool> против флагов по байту
+// (s21::vector<unsigned char>, как раньше хранился vector<bool>): память,
+// подсчет, обход установленных битов и пересечение масок.
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, std::size_t(1) << 28);
+  int rounds = 5;
+
+  s21::vector<unsigned char> bytes, other_bytes;
+  s21::bit_vector bits, other_bits;
+  bench::report("fill: byte per flag", bench::run([&] {
+                  bytes.resize(n);
+                  other_bytes.resize(n);
+                }));
+  bench::report("fill: packed bits", bench::run([&] {
+                  bits.resize(n);
+                  other_bits.resize(n);
+                }));
+  // редкие флаги, как в множестве посещенных вершин
+  std::uint64_t x = 88172645463325252ull;
+  for (std::size_t i = 0; i < n / 64; i++) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    bytes[x % n] = 1;
+    bits.set(x % n);
+    other_bytes[(x >> 7) % n] = 1;
+    other_bits.set((x >> 7) % n);
+  }
+
+  std::size_t sink = 0;
+  bench::report("count: byte per flag", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    std::size_t count = 0;
+                    for (std::size_t i = 0; i < n; i++) {
+                      count += bytes[i];
+                    }
+                    sink += count;
+                  }
+                }));
+  bench::report("count: packed popcount", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    sink += bits.count();
+                  }
+                }));
+  bench::report("set bits: byte per flag", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    for (std::size_t i = 0; i < n; i++) {
+                      if (bytes[i]) {
+                        sink += i;
+                      }
+                    }
+                  }
+                }));
+  bench::report("set bits: for_each_set", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    bits.for_each_set([&sink](std::size_t i) { sink += i; });
+                  }
+                }));
+  bench::report("and: byte per flag", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    for (std::size_t i = 0; i < n; i++) {
+                      bytes[i] &= other_bytes[i];
+                    }
+                  }
+                }));
+  bench::report("and: packed &=", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    bits &= other_bits;
+                  }
+                }));
+  std::printf("%zu flags: %zu MB as bytes, %zu MB packed\n", n,
+              bytes.capacity() >> 20, (bits.capacity() / 8) >> 20);
+  bench::keep(sink);
+  bench::keep(bytes);
+  bench::keep(bits);
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Добавление из многих потоков: s21::vector под мьютексом против
+// s21::concurrent_vector. Общее число элементов одинаково для любого
+// числа потоков, от 1 до 64.
+namespace {
+template <typename Append>
+void run_threads(std::size_t threads, std::size_t total, Append append) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < threads; t++) {
+    pool.emplace_back([&append, t, threads, total] {
+      for (std::size_t i = t; i < total; i += threads) {
+        append(i);
+      }
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+void report(const char *op, std::size_t threads, std::size_t total,
+            const bench::Result &result) {
+  std::string name = std::string(op) + " [" + std::to_string(threads) + "t]";
+  bench::report(name.c_str(), result);
+  std::printf("  %.1f M appends/s\n", total / result.seconds / 1e6);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t total = bench::size_arg(argc, argv, 1 << 23);
+  for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+    s21::vector<std::uint64_t> locked;
+    std::mutex mutex;
+    report("vector + mutex push_back", threads, total,
+           bench::run([&] {
+             run_threads(threads, total, [&](std::size_t i) {
+               std::lock_guard<std::mutex> lock(mutex);
+               locked.push_back(i);
+             });
+           }));
+    s21::concurrent_vector<std::uint64_t> shared;
+    report("concurrent_vector push_back", threads, total,
+           bench::run([&] {
+             run_threads(threads, total,
+                         [&](std::size_t i) { shared.push_back(i); });
+           }));
+    s21::concurrent_vector<std::uint64_t> batched;
+    report("concurrent_vector grow_by(64)", threads, total / 64 * 64,
+           bench::run([&] {
+             run_threads(threads, total / 64, [&](std::size_t i) {
+               auto it = batched.grow_by(64);
+               for (std::size_t j = 0; j < 64; j++) {
+                 it[j] = i * 64 + j;
+               }
+             });
+           }));
+    bench::keep(locked);
+    bench::keep(shared);
+    bench::keep(batched);
+  }
+  return 0;
+}
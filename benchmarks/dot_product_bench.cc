@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+namespace {
+// Ядра через operator[] (без проверки индекса, как у std)
+template <typename Vector>
+auto dot_unchecked(Vector &a, Vector &b) {
+  typename Vector::value_type sum = 0;
+  for (std::size_t i = 0; i < a.size(); i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+template <typename Vector>
+void axpy_unchecked(double k, Vector &x, Vector &y) {
+  for (std::size_t i = 0; i < x.size(); i++) {
+    y[i] += k * x[i];
+  }
+}
+
+// Те же ядра через at(): так работал operator[] раньше, с проверкой и
+// возможным исключением на каждом обращении
+template <typename Vector>
+auto dot_checked(Vector &a, Vector &b) {
+  typename Vector::value_type sum = 0;
+  for (std::size_t i = 0; i < a.size(); i++) {
+    sum += a.at(i) * b.at(i);
+  }
+  return sum;
+}
+
+template <typename Vector>
+void axpy_checked(double k, Vector &x, Vector &y) {
+  for (std::size_t i = 0; i < x.size(); i++) {
+    y.at(i) += k * x.at(i);
+  }
+}
+
+template <typename Kernel>
+bench::Result repeat(int rounds, Kernel kernel) {
+  return bench::run([rounds, &kernel] {
+    for (int r = 0; r < rounds; r++) {
+      kernel();
+    }
+  });
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 14);
+  int rounds = 20000;
+
+  s21::vector<std::int32_t> ia(n), ib(n);
+  s21::vector<double> x(n), y(n);
+  std::vector<std::int32_t> sia(n), sib(n);
+  std::vector<double> sx(n), sy(n);
+  for (std::size_t i = 0; i < n; i++) {
+    ia[i] = sia[i] = static_cast<std::int32_t>(i % 13);
+    ib[i] = sib[i] = static_cast<std::int32_t>(i % 7);
+    x[i] = sx[i] = 1.0 / (i + 1);
+  }
+
+  std::int64_t sum = 0;
+  bench::report("s21::vector<int32> dot, at()",
+                repeat(rounds, [&] { sum += dot_checked(ia, ib); }));
+  bench::report("s21::vector<int32> dot, operator[]",
+                repeat(rounds, [&] { sum += dot_unchecked(ia, ib); }));
+  bench::report("std::vector<int32> dot, operator[]",
+                repeat(rounds, [&] { sum += dot_unchecked(sia, sib); }));
+
+  bench::report("s21::vector<double> axpy, at()",
+                repeat(rounds, [&] { axpy_checked(0.5, x, y); }));
+  bench::report("s21::vector<double> axpy, operator[]",
+                repeat(rounds, [&] { axpy_unchecked(0.5, x, y); }));
+  bench::report("std::vector<double> axpy, operator[]",
+                repeat(rounds, [&] { axpy_unchecked(0.5, sx, sy); }));
+  bench::keep(sum);
+  bench::keep(y);
+  bench::keep(sy);
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Счетчики потоков: s21::array<std::atomic<uint64_t>, 64>, где соседние
+// счетчики делят строку кэша, против s21::padded_array с отдельной строкой
+// на счетчик. Каждый поток делает одно и то же число приращений своего
+// счетчика; разница видна, когда потоки идут на разных ядрах.
+namespace {
+template <typename Counters>
+void run_threads(Counters &counters, std::size_t threads,
+                 std::size_t increments) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < threads; t++) {
+    pool.emplace_back([&counters, t, increments] {
+      for (std::size_t i = 0; i < increments; i++) {
+        counters[t].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+void report(const char *name, std::size_t threads, std::size_t increments,
+            const bench::Result &result) {
+  std::string label = std::string(name) + " [" + std::to_string(threads) + "t]";
+  bench::report(label.c_str(), result);
+  std::printf("  %.1f M increments/s\n",
+              threads * increments / result.seconds / 1e6);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t increments = bench::size_arg(argc, argv, 1 << 24);
+  unsigned cores = std::thread::hardware_concurrency();
+  std::printf("hardware threads: %u\n", cores);
+  for (std::size_t threads : {1, 2, 4, 8}) {
+    s21::array<std::atomic<std::uint64_t>, 64> packed{};
+    report("s21::array (shared lines)", threads, increments,
+           bench::run([&] { run_threads(packed, threads, increments); }));
+    s21::padded_array<std::atomic<std::uint64_t>, 64> padded;
+    report("s21::padded_array (own lines)", threads, increments,
+           bench::run([&] { run_threads(padded, threads, increments); }));
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Случайный доступ к большому вектору: обычный аллокатор против
+// huge_page_allocator. Размер задается в МиБ первым аргументом. Промахи
+// dTLB считаются через perf_event_open, если ядро это разрешает.
+namespace {
+class TlbMisses {
+ public:
+  TlbMisses() {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd_ >= 0) {
+      ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+  ~TlbMisses() {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+  void print(const char *name) const {
+    std::uint64_t count = 0;
+    if (fd_ >= 0 && ::read(fd_, &count, sizeof(count)) == sizeof(count)) {
+      std::printf("%-40s %10.1f M dTLB misses\n", name, count / 1e6);
+    } else {
+      std::printf("%-40s %13s dTLB misses\n", name, "n/a");
+    }
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+template <typename Vector>
+void random_access(const char *name, std::size_t n, std::size_t lookups) {
+  Vector v;
+  std::string label = std::string(name) + ": fill";
+  bench::report(label.c_str(), bench::run([&] {
+                  v.reserve(n);
+                  for (std::size_t i = 0; i < n; i++) {
+                    v.push_back(i);
+                  }
+                }));
+  std::uint64_t sum = 0;
+  label = std::string(name) + ": random reads";
+  TlbMisses misses;
+  bench::report(label.c_str(), bench::run([&] {
+                  std::uint64_t x = 88172645463325252ull;
+                  for (std::size_t i = 0; i < lookups; i++) {
+                    x ^= x << 13;
+                    x ^= x >> 7;
+                    x ^= x << 17;
+                    sum += v[x % n];
+                  }
+                }));
+  misses.print(label.c_str());
+  bench::keep(sum);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t mib = bench::size_arg(argc, argv, 2048);
+  std::size_t n = (mib << 20) / sizeof(std::uint64_t);
+  std::size_t lookups = 20000000;
+  random_access<s21::vector<std::uint64_t>>("vector (4 KiB pages)", n,
+                                            lookups);
+  random_access<s21::huge_page_vector<std::uint64_t>>("huge_page_vector", n,
+                                                      lookups);
+  return 0;
+}
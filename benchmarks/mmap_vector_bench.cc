@@ -0,0 +1,56 @@
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Загрузка сохраненного массива при старте: чтение файла в s21::vector
+// против открытия того же файла как s21::mmap_vector (без копирования)
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 24);
+  char name[] = "/tmp/s21_mmap_bench_XXXXXX";
+  ::close(::mkstemp(name));
+  std::string path = name;
+
+  bench::report("write + sync (mmap_vector)", bench::run([&] {
+                  s21::mmap_vector<double> v(path);
+                  v.reserve(n);
+                  for (std::size_t i = 0; i < n; i++) {
+                    v.push_back(static_cast<double>(i % 1000) / 7);
+                  }
+                  v.sync();
+                }));
+
+  double sink = 0;
+  bench::report("load: fread into s21::vector", bench::run([&] {
+                  s21::vector<double> v;
+                  std::FILE *f = std::fopen(path.c_str(), "rb");
+                  std::fseek(f, s21::mmap_vector<double>::kHeaderBytes,
+                             SEEK_SET);
+                  v.resize(n);
+                  std::size_t got = std::fread(v.data(), sizeof(double), n, f);
+                  std::fclose(f);
+                  sink += v[got / 2];
+                }));
+  bench::report("load: open mmap_vector read_only", bench::run([&] {
+                  s21::mmap_vector<double> v(path, s21::mmap_mode::read_only);
+                  sink += v[v.size() / 2];
+                }));
+  bench::report("load: open mmap_vector copy_on_write", bench::run([&] {
+                  s21::mmap_vector<double> v(path,
+                                             s21::mmap_mode::copy_on_write);
+                  v[0] = 1;
+                  sink += v[v.size() / 2];
+                }));
+  bench::report("load + full scan (mmap_vector)", bench::run([&] {
+                  s21::mmap_vector<double> v(path, s21::mmap_mode::read_only);
+                  for (double x : v) {
+                    sink += x;
+                  }
+                }));
+  bench::keep(sink);
+  ::unlink(name);
+  return 0;
+}
@@ -0,0 +1,59 @@
+#include <cstdint>
+#include <string>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Масштабирование s21::parallel по числу потоков: пул с 0 рабочих (только
+// вызывающий поток) и далее до thread_pool::default_workers()
+namespace {
+template <typename Kernel>
+void report(const char *op, std::size_t threads, Kernel kernel) {
+  std::string name = std::string(op) + " [" + std::to_string(threads) + "t]";
+  bench::report(name.c_str(), bench::run(kernel));
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 10000000);
+
+  s21::vector<std::uint64_t> keys(n), scanned(n);
+  s21::vector<double> values(n), scaled(n);
+  std::uint64_t seed = 88172645463325252ull;
+  for (std::size_t i = 0; i < n; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    keys[i] = seed;
+    values[i] = static_cast<double>(seed % 1000) / 7;
+  }
+
+  std::uint64_t isink = 0;
+  double dsink = 0;
+  std::size_t max_workers = s21::parallel::thread_pool::default_workers();
+  for (std::size_t workers = 0; workers <= max_workers;
+       workers = workers == 0 ? 1 : workers * 2) {
+    s21::parallel::thread_pool pool(workers);
+    std::size_t threads = pool.concurrency();
+    report("reduce<uint64>", threads, [&] {
+      isink += s21::parallel::reduce(keys, std::uint64_t(0), std::plus<>(),
+                                     pool);
+    });
+    report("transform<double>", threads, [&] {
+      s21::parallel::transform(
+          values, scaled, [](double x) { return x * 1.5 + 2; }, pool);
+    });
+    report("inclusive_scan<uint64>", threads, [&] {
+      s21::parallel::inclusive_scan(keys, scanned, std::plus<>(), pool);
+    });
+    s21::vector<std::uint64_t> unsorted(keys);
+    report("sort<uint64>", threads,
+           [&] { s21::parallel::sort(unsorted, std::less<>(), pool); });
+    isink += unsorted[n / 2];
+  }
+  dsink += scaled[n / 2];
+  bench::keep(isink);
+  bench::keep(dsink);
+  bench::keep(scanned);
+  return 0;
+}
@@ -0,0 +1,62 @@
+#include <queue>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Очередь сообщений: n push и n pop, сначала потоком (в очереди держится
+// окно из 1024 сообщений), затем целиком (сначала все push, потом все pop).
+// s21::queue на кольцевом буфере против std::queue (std::deque).
+struct Message {
+  long id;
+  double payload;
+};
+
+template <typename Queue>
+void streaming(Queue &q, std::size_t n, long &sink) {
+  for (std::size_t i = 0; i < n; i++) {
+    q.push(Message{static_cast<long>(i), 1.0});
+    if (q.size() > 1024) {
+      sink += q.front().id;
+      q.pop();
+    }
+  }
+  while (!q.empty()) {
+    sink += q.front().id;
+    q.pop();
+  }
+}
+
+template <typename Queue>
+void fill_then_drain(Queue &q, std::size_t n, long &sink) {
+  for (std::size_t i = 0; i < n; i++) {
+    q.push(Message{static_cast<long>(i), 1.0});
+  }
+  while (!q.empty()) {
+    sink += q.front().id;
+    q.pop();
+  }
+}
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 10000000);
+  long sink = 0;
+
+  bench::report("std::queue streaming", bench::run([&] {
+                  std::queue<Message> q;
+                  streaming(q, n, sink);
+                }));
+  bench::report("s21::queue streaming", bench::run([&] {
+                  s21::queue<Message> q;
+                  streaming(q, n, sink);
+                }));
+  bench::report("std::queue fill then drain", bench::run([&] {
+                  std::queue<Message> q;
+                  fill_then_drain(q, n, sink);
+                }));
+  bench::report("s21::queue fill then drain", bench::run([&] {
+                  s21::queue<Message> q;
+                  fill_then_drain(q, n, sink);
+                }));
+  bench::keep(sink);
+  return 0;
+}
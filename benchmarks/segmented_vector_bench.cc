@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Задержка одного push_back: s21::vector время от времени переносит все
+// элементы, segmented_vector только добавляет сегмент. Печатаются
+// перцентили задержки по всем вставкам и общее время.
+namespace {
+struct Record {
+  std::uint64_t key;
+  std::uint64_t payload[3];
+};
+
+template <typename Vector>
+void latency(const char *name, std::size_t n) {
+  // буфер замеров выделен заранее и не попадает в измерения
+  std::vector<std::uint32_t> ns(n);
+  Vector v;
+  bench::Result total = bench::run([&] {
+    for (std::size_t i = 0; i < n; i++) {
+      auto start = std::chrono::steady_clock::now();
+      v.push_back(Record{i, {i, i, i}});
+      auto stop = std::chrono::steady_clock::now();
+      ns[i] = static_cast<std::uint32_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+              .count());
+    }
+  });
+  bench::report(name, total);
+  std::sort(ns.begin(), ns.end());
+  auto pct = [&](double p) {
+    return ns[std::min(n - 1, static_cast<std::size_t>(p * n))];
+  };
+  std::printf("  p50 %u ns  p99 %u ns  p99.9 %u ns  p99.99 %u ns  max %.3f ms\n",
+              pct(0.5), pct(0.99), pct(0.999), pct(0.9999), ns[n - 1] / 1e6);
+  bench::keep(v);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 24);
+  latency<s21::vector<Record>>("s21::vector push_back", n);
+  latency<s21::segmented_vector<Record>>("s21::segmented_vector push_back", n);
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Сохранение и загрузка контрольной точки: s21::serialize (один writev для
+// вектора, блоки и линейная сборка дерева для map) против поэлементной
+// записи и чтения через fstream с загрузкой map вставками по одной
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 22);
+  char name[] = "/tmp/s21_serialize_bench_XXXXXX";
+  ::close(::mkstemp(name));
+  std::string path = name;
+
+  s21::vector<double> values;
+  for (std::size_t i = 0; i < n; i++) {
+    values.push_back(static_cast<double>(i % 1000) / 7);
+  }
+  s21::map<std::int64_t, double> index;
+  for (std::size_t i = 0; i < n / 4; i++) {
+    index.insert(static_cast<std::int64_t>(i) * 2, static_cast<double>(i));
+  }
+  double sink = 0;
+
+  bench::report("vector save: element stream", bench::run([&] {
+                  std::ofstream out(path, std::ios::binary);
+                  std::uint64_t count = values.size();
+                  out.write(reinterpret_cast<const char *>(&count),
+                            sizeof(count));
+                  for (std::size_t i = 0; i < values.size(); i++) {
+                    out.write(reinterpret_cast<const char *>(&values[i]),
+                              sizeof(double));
+                  }
+                }));
+  bench::report("vector load: element stream", bench::run([&] {
+                  std::ifstream in(path, std::ios::binary);
+                  std::uint64_t count = 0;
+                  in.read(reinterpret_cast<char *>(&count), sizeof(count));
+                  s21::vector<double> v;
+                  for (std::uint64_t i = 0; i < count; i++) {
+                    double x;
+                    in.read(reinterpret_cast<char *>(&x), sizeof(x));
+                    v.push_back(x);
+                  }
+                  sink += v[v.size() / 2];
+                }));
+  bench::report("vector save: s21::serialize(fd)", bench::run([&] {
+                  int fd = ::open(path.c_str(), O_WRONLY | O_TRUNC);
+                  s21::serialize(fd, values);
+                  ::close(fd);
+                }));
+  bench::report("vector load: s21::deserialize(fd)", bench::run([&] {
+                  int fd = ::open(path.c_str(), O_RDONLY);
+                  s21::vector<double> v;
+                  s21::deserialize(fd, v);
+                  ::close(fd);
+                  sink += v[v.size() / 2];
+                }));
+
+  bench::report("map save: element stream", bench::run([&] {
+                  std::ofstream out(path, std::ios::binary);
+                  std::uint64_t count = index.size();
+                  out.write(reinterpret_cast<const char *>(&count),
+                            sizeof(count));
+                  for (auto it = index.begin(); it != index.end(); ++it) {
+                    out.write(reinterpret_cast<const char *>(&it->key_),
+                              sizeof(it->key_));
+                    out.write(reinterpret_cast<const char *>(&it->value_),
+                              sizeof(it->value_));
+                  }
+                }));
+  bench::report("map load: element stream + insert", bench::run([&] {
+                  std::ifstream in(path, std::ios::binary);
+                  std::uint64_t count = 0;
+                  in.read(reinterpret_cast<char *>(&count), sizeof(count));
+                  s21::map<std::int64_t, double> m;
+                  for (std::uint64_t i = 0; i < count; i++) {
+                    std::int64_t key;
+                    double value;
+                    in.read(reinterpret_cast<char *>(&key), sizeof(key));
+                    in.read(reinterpret_cast<char *>(&value), sizeof(value));
+                    m.insert(key, value);
+                  }
+                  sink += m.size();
+                }));
+  bench::report("map save: s21::serialize(fd)", bench::run([&] {
+                  int fd = ::open(path.c_str(), O_WRONLY | O_TRUNC);
+                  s21::serialize(fd, index);
+                  ::close(fd);
+                }));
+  bench::report("map load: s21::deserialize(fd)", bench::run([&] {
+                  int fd = ::open(path.c_str(), O_RDONLY);
+                  s21::map<std::int64_t, double> m;
+                  s21::deserialize(fd, m);
+                  ::close(fd);
+                  sink += m.size();
+                }));
+  bench::keep(sink);
+  ::unlink(name);
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "../containers.h"
+#include "bench.h"
+
+namespace {
+const char *isa_name(s21::simd::isa isa) {
+  switch (isa) {
+    case s21::simd::isa::avx2:
+      return "avx2";
+    case s21::simd::isa::sse2:
+      return "sse2";
+    default:
+      return "scalar";
+  }
+}
+
+template <typename Kernel>
+void report(const char *op, s21::simd::isa isa, int rounds, Kernel kernel) {
+  std::string name = std::string(op) + " [" + isa_name(isa) + "]";
+  bench::report(name.c_str(), bench::run([rounds, &kernel] {
+                  for (int r = 0; r < rounds; r++) {
+                    kernel();
+                  }
+                }));
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 16);
+  int rounds = 5000;
+
+  s21::vector<double> prices(n), weights(n), scaled(n);
+  s21::vector<std::int32_t> ids(n), id_sums(n);
+  for (std::size_t i = 0; i < n; i++) {
+    prices[i] = 1.0 + static_cast<double>(i % 1000) / 7;
+    weights[i] = static_cast<double>(i % 3);
+    ids[i] = static_cast<std::int32_t>(i % 9973);
+  }
+
+  double dsink = 0;
+  std::size_t isink = 0;
+  s21::simd::isa best = s21::simd::best_isa();
+  for (s21::simd::isa isa :
+       {s21::simd::isa::scalar, s21::simd::isa::sse2, s21::simd::isa::avx2}) {
+    if (isa > best) {
+      continue;
+    }
+    s21::simd::use_isa(isa);
+    report("sum<double>", isa, rounds,
+           [&] { dsink += s21::simd::sum(prices); });
+    report("min<double>", isa, rounds,
+           [&] { dsink += s21::simd::min(prices); });
+    report("max<int32>", isa, rounds,
+           [&] { isink += s21::simd::max(ids); });
+    report("count<int32>", isa, rounds,
+           [&] { isink += s21::simd::count(ids, 42); });
+    report("find<int32> (miss)", isa, rounds,
+           [&] { isink += s21::simd::find(ids, -1) - ids.begin(); });
+    report("fill<double>", isa, rounds,
+           [&] { s21::simd::fill(scaled, 0.5); });
+    report("transform<double> multiplies", isa, rounds, [&] {
+      s21::simd::transform(prices, weights, scaled, std::multiplies<>());
+    });
+    report("transform<int32> plus", isa, rounds, [&] {
+      s21::simd::transform(ids, ids, id_sums, std::plus<>());
+    });
+  }
+  s21::simd::use_isa(best);
+  bench::keep(dsink);
+  bench::keep(isink);
+  bench::keep(scaled);
+  bench::keep(id_sums);
+  return 0;
+}
@@ -0,0 +1,46 @@
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+namespace {
+struct Field {
+  int tag;
+  int offset;
+};
+
+// На каждое сообщение собирается короткий список полей (от 1 до 7)
+template <typename Vector>
+void per_message(std::size_t messages) {
+  long checksum = 0;
+  for (std::size_t m = 0; m < messages; m++) {
+    Vector fields;
+    int count = static_cast<int>(m % 7) + 1;
+    for (int i = 0; i < count; i++) {
+      fields.push_back(Field{i, static_cast<int>(m) + i});
+    }
+    for (Field &field : fields) {
+      checksum += field.tag + field.offset;
+    }
+  }
+  bench::keep(checksum);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t messages = bench::size_arg(argc, argv, 1000000);
+
+  bench::report("s21::vector<Field> per message",
+                bench::run([messages] {
+                  per_message<s21::vector<Field>>(messages);
+                }));
+  bench::report("s21::small_vector<Field, 8> per message",
+                bench::run([messages] {
+                  per_message<s21::small_vector<Field, 8>>(messages);
+                }));
+  bench::report("std::vector<Field> per message",
+                bench::run([messages] {
+                  per_message<std::vector<Field>>(messages);
+                }));
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <cstdint>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Сумма одного поля по всем записям: массив структур (s21::vector) против
+// столбцов s21::soa_vector. Запись - 32 байта, из которых нужно 4.
+namespace {
+struct Particle {
+  float x, y, z;
+  std::int32_t id;
+  float vx, vy, vz;
+  std::int32_t flags;
+};
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 22);
+  int rounds = 50;
+
+  s21::vector<Particle> aos;
+  s21::soa_vector<float, float, float, std::int32_t, float, float, float,
+                  std::int32_t>
+      soa;
+  aos.reserve(n);
+  soa.reserve(n);
+  for (std::size_t i = 0; i < n; i++) {
+    float v = static_cast<float>(i % 1000) / 8;
+    std::int32_t id = static_cast<std::int32_t>(i);
+    aos.push_back(Particle{v, v, v, id, v, v, v, 0});
+    soa.emplace_back(v, v, v, id, v, v, v, 0);
+  }
+
+  double sink = 0;
+  bench::report("sum x: AoS loop", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    float sum = 0;
+                    for (std::size_t i = 0; i < n; i++) {
+                      sum += aos[i].x;
+                    }
+                    sink += sum;
+                  }
+                }));
+  bench::report("sum x: SoA loop", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    auto xs = soa.column<0>();
+                    float sum = 0;
+                    for (std::size_t i = 0; i < n; i++) {
+                      sum += xs[i];
+                    }
+                    sink += sum;
+                  }
+                }));
+  bench::report("sum x: SoA simd::sum", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    sink += s21::simd::sum(soa.column<0>());
+                  }
+                }));
+  bench::report("count id == 42: AoS loop", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    std::size_t count = 0;
+                    for (std::size_t i = 0; i < n; i++) {
+                      count += aos[i].id == 42;
+                    }
+                    sink += count;
+                  }
+                }));
+  bench::report("count id == 42: SoA simd::count", bench::run([&] {
+                  for (int r = 0; r < rounds; r++) {
+                    sink += s21::simd::count(soa.column<3>(), 42);
+                  }
+                }));
+  bench::keep(sink);
+  return 0;
+}
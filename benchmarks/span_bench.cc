@@ -0,0 +1,43 @@
+#include <cstdio>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Обработка подотрезков вектора: копия куска в новый s21::vector против
+// s21::span без копирования. Каждый из chunks кусков суммируется simd::sum.
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 24);
+  const std::size_t chunks = 64;
+  s21::vector<float> v;
+  v.resize(n);
+  for (std::size_t i = 0; i < n; i++) {
+    v[i] = static_cast<float>(i % 100);
+  }
+  std::size_t chunk = n / chunks;
+  float sink = 0;
+
+  bench::report("sub-range copy into s21::vector", bench::run([&] {
+                  for (std::size_t c = 0; c < chunks; c++) {
+                    s21::vector<float> part;
+                    part.assign(v.data() + c * chunk,
+                                v.data() + (c + 1) * chunk);
+                    sink += s21::simd::sum(part);
+                  }
+                }));
+  bench::report("sub-range as s21::span", bench::run([&] {
+                  s21::span<const float> all(v);
+                  for (std::size_t c = 0; c < chunks; c++) {
+                    sink += s21::simd::sum(all.subspan(c * chunk, chunk));
+                  }
+                }));
+  bench::report("every 16th element, strided_view", bench::run([&] {
+                  s21::strided_view<const float> lane(v, 16);
+                  float total = 0;
+                  for (float x : lane) {
+                    total += x;
+                  }
+                  sink += total;
+                }));
+  bench::keep(sink);
+  return 0;
+}
@@ -0,0 +1,43 @@
+#include <stack>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+// n push, затем n pop: s21::stack (над s21::vector) против std::stack над
+// std::deque и std::vector
+template <typename Stack>
+void push_then_pop(Stack &s, std::size_t n, long &sink) {
+  for (std::size_t i = 0; i < n; i++) {
+    s.push(static_cast<long>(i));
+  }
+  while (!s.empty()) {
+    sink += s.top();
+    s.pop();
+  }
+}
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 10000000);
+  long sink = 0;
+
+  bench::report("std::stack (deque)", bench::run([&] {
+                  std::stack<long> s;
+                  push_then_pop(s, n, sink);
+                }));
+  bench::report("std::stack (vector)", bench::run([&] {
+                  std::stack<long, std::vector<long>> s;
+                  push_then_pop(s, n, sink);
+                }));
+  bench::report("s21::stack", bench::run([&] {
+                  s21::stack<long> s;
+                  push_then_pop(s, n, sink);
+                }));
+  bench::report("s21::stack, reserve(n)", bench::run([&] {
+                  s21::stack<long> s;
+                  s.reserve(n);
+                  push_then_pop(s, n, sink);
+                }));
+  bench::keep(sink);
+  return 0;
+}
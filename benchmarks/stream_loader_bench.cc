@@ -0,0 +1,127 @@
+#include <unistd.h>
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "../containers.h"
+#include "bench.h"
+
+// Загрузка CSV и двоичного файла в s21::vector: чтение всего файла в
+// память и разбор против потоковой загрузки s21::load_lines/load_records
+// (read() в буфер и окна mmap). Печатает скорость в МБ/с и пиковую память
+// загрузки помимо самого контейнера.
+namespace {
+struct Row {
+  std::int64_t id;
+  double price;
+};
+
+std::optional<Row> parse_row(std::string_view line) {
+  Row row;
+  const char *end = line.data() + line.size();
+  auto key = std::from_chars(line.data(), end, row.id);
+  if (key.ec != std::errc() || key.ptr == end) {
+    return std::nullopt;
+  }
+  std::from_chars(key.ptr + 1, end, row.price);
+  return row;
+}
+
+void report(const char *name, const bench::Result &result,
+            std::size_t file_bytes) {
+  bench::report(name, result);
+  std::printf("%-40s %10.1f MB/s\n", "", file_bytes / result.seconds / 1e6);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1 << 22);
+  char csv_name[] = "/tmp/s21_stream_csv_XXXXXX";
+  char bin_name[] = "/tmp/s21_stream_bin_XXXXXX";
+  ::close(::mkstemp(csv_name));
+  ::close(::mkstemp(bin_name));
+  {
+    std::ofstream csv(csv_name);
+    std::ofstream bin(bin_name, std::ios::binary);
+    csv << "id,price\n";
+    for (std::size_t i = 0; i < n; i++) {
+      Row row{static_cast<std::int64_t>(i) * 7, (i % 10000) * 0.25};
+      csv << row.id << ',' << row.price << '\n';
+      bin.write(reinterpret_cast<const char *>(&row), sizeof(row));
+    }
+  }
+  std::size_t csv_bytes = 0;
+  {
+    std::ifstream csv(csv_name, std::ios::binary | std::ios::ate);
+    csv_bytes = static_cast<std::size_t>(csv.tellg());
+  }
+  std::size_t bin_bytes = n * sizeof(Row);
+  std::size_t sink = 0;
+
+  // контейнер заранее зарезервирован, peak показывает только загрузку
+  s21::vector<Row> rows;
+  rows.reserve(n);
+  report("csv: whole file in memory", bench::run([&] {
+           std::ifstream csv(csv_name, std::ios::binary);
+           std::stringstream whole;
+           whole << csv.rdbuf();
+           std::string text = whole.str();
+           std::string_view rest(text);
+           while (!rest.empty()) {
+             std::size_t newline = rest.find('\n');
+             std::optional<Row> row = parse_row(rest.substr(0, newline));
+             if (row) {
+               rows.push_back(*row);
+             }
+             rest.remove_prefix(newline == std::string_view::npos
+                                    ? rest.size()
+                                    : newline + 1);
+           }
+           sink += rows.size();
+         }),
+         csv_bytes);
+  for (bool use_mmap : {false, true}) {
+    s21::stream_options options;
+    options.use_mmap = use_mmap;
+    rows.clear();
+    report(use_mmap ? "csv: load_lines, mmap windows"
+                    : "csv: load_lines, read() buffer",
+           bench::run([&] {
+             sink += s21::load_lines(csv_name, rows, parse_row, options);
+           }),
+           csv_bytes);
+  }
+
+  rows.clear();
+  report("bin: whole file in memory", bench::run([&] {
+           std::ifstream bin(bin_name, std::ios::binary);
+           s21::vector<char> whole;
+           whole.resize(bin_bytes);
+           bin.read(whole.data(), static_cast<std::streamsize>(bin_bytes));
+           const Row *first = reinterpret_cast<const Row *>(whole.data());
+           rows.insert(rows.end(), first, first + n);
+           sink += rows.size();
+         }),
+         bin_bytes);
+  for (bool use_mmap : {false, true}) {
+    s21::stream_options options;
+    options.use_mmap = use_mmap;
+    rows.clear();
+    report(use_mmap ? "bin: load_records, mmap windows"
+                    : "bin: load_records, read() buffer",
+           bench::run([&] {
+             sink += s21::load_records<Row>(bin_name, rows, options);
+           }),
+           bin_bytes);
+  }
+  bench::keep(sink);
+  ::unlink(csv_name);
+  ::unlink(bin_name);
+  return 0;
+}
@@ -0,0 +1,52 @@
+#include <string>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+namespace {
+// Пачка из batch элементов вставляется в середину: по одному или целиком
+template <typename Vector, typename Value>
+void one_by_one(std::size_t n, std::size_t batch, const Value &value) {
+  Vector v(n);
+  for (std::size_t i = 0; i < batch; i++) {
+    v.insert(v.begin() + n / 2, value);
+  }
+  bench::keep(v);
+}
+
+template <typename Vector, typename Value>
+void whole_batch(std::size_t n, std::size_t batch, const Value &value) {
+  Vector v(n);
+  v.insert(v.begin() + n / 2, batch, value);
+  bench::keep(v);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1000000);
+  std::size_t batch = 1000;
+  std::string word = "word";
+
+  bench::report("s21::vector<int> insert one by one", bench::run([&] {
+                  one_by_one<s21::vector<int>>(n, batch, 7);
+                }));
+  bench::report("s21::vector<int> insert(pos, n, value)", bench::run([&] {
+                  whole_batch<s21::vector<int>>(n, batch, 7);
+                }));
+  bench::report("std::vector<int> insert(pos, n, value)", bench::run([&] {
+                  whole_batch<std::vector<int>>(n, batch, 7);
+                }));
+  bench::report("s21::vector<string> insert one by one", bench::run([&] {
+                  one_by_one<s21::vector<std::string>>(n / 10, batch, word);
+                }));
+  bench::report("s21::vector<string> insert(pos, n, value)",
+                bench::run([&] {
+                  whole_batch<s21::vector<std::string>>(n / 10, batch, word);
+                }));
+  bench::report("std::vector<string> insert(pos, n, value)",
+                bench::run([&] {
+                  whole_batch<std::vector<std::string>>(n / 10, batch, word);
+                }));
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+namespace {
+// Тип, который можно только перемещать
+struct MoveOnly {
+  explicit MoveOnly(int v) : value(v) {}
+  MoveOnly(const MoveOnly &) = delete;
+  MoveOnly(MoveOnly &&other) noexcept : value(other.value) {}
+  MoveOnly &operator=(MoveOnly &&other) noexcept {
+    value = other.value;
+    return *this;
+  }
+  int value;
+};
+
+template <typename Vector>
+void push_ints(std::size_t n) {
+  Vector v;
+  for (std::size_t i = 0; i < n; i++) {
+    v.push_back(static_cast<int>(i));
+  }
+  bench::keep(v);
+}
+
+template <typename Vector>
+void emplace_move_only(std::size_t n) {
+  Vector v;
+  for (std::size_t i = 0; i < n; i++) {
+    v.emplace_back(static_cast<int>(i));
+  }
+  bench::keep(v);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 100000000);
+  std::printf("growth factor %d/%d, %zu elements\n", S21_VECTOR_GROWTH_NUM,
+              S21_VECTOR_GROWTH_DEN, n);
+
+  bench::report("s21::vector<int> push_back",
+                bench::run([n] { push_ints<s21::vector<int>>(n); }));
+  bench::report("std::vector<int> push_back",
+                bench::run([n] { push_ints<std::vector<int>>(n); }));
+  bench::report("s21::vector<MoveOnly> emplace_back", bench::run([n] {
+                  emplace_move_only<s21::vector<MoveOnly>>(n);
+                }));
+  bench::report("std::vector<MoveOnly> emplace_back", bench::run([n] {
+                  emplace_move_only<std::vector<MoveOnly>>(n);
+                }));
+  return 0;
+}
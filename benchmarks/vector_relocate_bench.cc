@@ -0,0 +1,55 @@
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+namespace {
+struct Pod {
+  double x, y, z;
+  int id;
+};
+
+template <typename Vector>
+void grow(std::size_t n) {
+  Vector v;
+  for (std::size_t i = 0; i < n; i++) {
+    v.push_back(Pod{1.0, 2.0, 3.0, static_cast<int>(i)});
+  }
+  bench::keep(v);
+}
+
+// Вставки и удаления в середине вектора
+template <typename Vector>
+void middle_edits(std::size_t n, std::size_t edits) {
+  Vector v;
+  for (std::size_t i = 0; i < n; i++) {
+    v.push_back(static_cast<int>(i));
+  }
+  for (std::size_t i = 0; i < edits; i++) {
+    v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+    v.erase(v.begin() + v.size() / 3);
+  }
+  bench::keep(v);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 10000000);
+
+  bench::report("s21::vector<Pod> push_back",
+                bench::run([n] { grow<s21::vector<Pod>>(n); }));
+  bench::report("s21::vector<Pod, malloc_allocator>", bench::run([n] {
+                  grow<s21::vector<Pod, s21::malloc_allocator<Pod>>>(n);
+                }));
+  bench::report("std::vector<Pod> push_back",
+                bench::run([n] { grow<std::vector<Pod>>(n); }));
+
+  std::size_t edits = 2000;
+  bench::report("s21::vector<int> middle insert/erase", bench::run([n, edits] {
+                  middle_edits<s21::vector<int>>(n / 10, edits);
+                }));
+  bench::report("std::vector<int> middle insert/erase", bench::run([n, edits] {
+                  middle_edits<std::vector<int>>(n / 10, edits);
+                }));
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include <string>
+#include <vector>
+
+#include "../containers.h"
+#include "bench.h"
+
+namespace {
+struct Large {
+  double values[32] = {};
+  std::string name = "large";
+};
+
+template <typename Vector>
+void reserve_only(std::size_t n) {
+  Vector v;
+  v.reserve(n);
+  bench::keep(v);
+}
+
+template <typename Vector, typename T>
+void grow(std::size_t n, const T &value) {
+  Vector v;
+  for (std::size_t i = 0; i < n; i++) {
+    v.push_back(value);
+  }
+  bench::keep(v);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = bench::size_arg(argc, argv, 1000000);
+  std::string text = "a string that does not fit the small buffer";
+
+  bench::report("s21::vector<string> reserve", bench::run([n] {
+                  reserve_only<s21::vector<std::string>>(n);
+                }));
+  bench::report("std::vector<string> reserve", bench::run([n] {
+                  reserve_only<std::vector<std::string>>(n);
+                }));
+  bench::report("s21::vector<string> push_back", bench::run([n, &text] {
+                  grow<s21::vector<std::string>>(n, text);
+                }));
+  bench::report("std::vector<string> push_back", bench::run([n, &text] {
+                  grow<std::vector<std::string>>(n, text);
+                }));
+  bench::report("s21::vector<Large> push_back", bench::run([n] {
+                  grow<s21::vector<Large>>(n / 10, Large());
+                }));
+  bench::report("std::vector<Large> push_back", bench::run([n] {
+                  grow<std::vector<Large>>(n / 10, Large());
+                }));
+  return 0;
+}
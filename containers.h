@@ -5,11 +5,26 @@
 #include <vector>
 
 #include "./containers/RBT.h"
+#include "./containers/algorithm.h"
+#include "./containers/aligned_allocator.h"
+#include "./containers/arena.h"
+#include "./containers/concurrent_vector.h"
 #include "./containers/list.h"
+#include "./containers/malloc_allocator.h"
 #include "./containers/map.h"
+#include "./containers/mmap_vector.h"
+#include "./containers/parallel.h"
+#include "./containers/pmr.h"
 #include "./containers/queue.h"
+#include "./containers/segmented_vector.h"
+#include "./containers/serialize.h"
 #include "./containers/set.h"
+#include "./containers/simd.h"
+#include "./containers/small_vector.h"
+#include "./containers/soa_vector.h"
+#include "./containers/span.h"
 #include "./containers/stack.h"
+#include "./containers/stream_loader.h"
 #include "./containers/vector.h"
 #include "containersplus.h"
 
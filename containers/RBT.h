@@ -2,12 +2,15 @@
 #define CONTAINERS_RB_TREE_H
 
 #include <iostream>
+#include <memory>
 #include <utility>  // for std::pair
 
+#include "memory.h"
 #include "stack.h"
 
 namespace s21 {
-template <typename Key, typename Value>
+template <typename Key, typename Value,
+          typename Allocator = std::allocator<std::pair<const Key, Value>>>
 class RBTree {
  public:
   class TreeIterator;
@@ -22,39 +25,67 @@ class RBTree {
   using const_iterator = ConstTreeIterator;
   using size_type = size_t;
   using pointer = value_type*;
+  using allocator_type = Allocator;
   // Конструктор для дерева
-  RBTree() : root_(nullptr), size_(0) {}
+  RBTree() : RBTree(Allocator()) {}
+  explicit RBTree(const Allocator& alloc)
+      : root_(nullptr), size_(0), alloc_(alloc) {}
   // копирование
   // копирование рекурсивное
-  RBTree(const RBTree& other) : root_(nullptr), size_(0) {
+  RBTree(const RBTree& other)
+      : root_(nullptr),
+        size_(0),
+        alloc_(node_traits::select_on_container_copy_construction(
+            other.alloc_)) {
     // теперь увеличивается размер в самой функции copyTree
     if (other.root_) {
       root_ = copyTree(other.root_, nullptr);
     }
   }
+  RBTree(const RBTree& other, const Allocator& alloc)
+      : root_(nullptr), size_(0), alloc_(alloc) {
+    if (other.root_) {
+      root_ = copyTree(other.root_, nullptr);
+    }
+  }
   // перемещение
-  RBTree(RBTree&& other) noexcept : root_(other.root_), size_(other.size_) {
+  RBTree(RBTree&& other) noexcept
+      : root_(other.root_), size_(other.size_), alloc_(other.alloc_) {
     other.root_ = nullptr;
     other.size_ = 0;
   }
+  RBTree(RBTree&& other, const Allocator& alloc)
+      : root_(nullptr), size_(0), alloc_(alloc) {
+    *this = std::move(other);
+  }
 
-  RBTree& operator=(const RBTree&& other) noexcept {
+  RBTree& operator=(const RBTree& other) {
     if (this != &other) {
       clear();
-      root_ = other.root_;
-      size_ = other.size_;
-      other.root_ = nullptr;
-      other.size_ = 0;
+      alloc_on_copy(alloc_, other.alloc_);
+      if (other.root_) {
+        root_ = copyTree(other.root_, nullptr);
+      }
     }
     return *this;
   }
-  RBTree& operator=(RBTree&& other) noexcept {
+  RBTree& operator=(RBTree&& other) {
     if (this != &other) {
       clear();
-      root_ = other.root_;
-      size_ = other.size_;
-      other.root_ = nullptr;
-      other.size_ = 0;
+      if (alloc_can_steal(alloc_, other.alloc_)) {
+        alloc_on_move(alloc_, other.alloc_);
+        root_ = other.root_;
+        size_ = other.size_;
+        other.root_ = nullptr;
+        other.size_ = 0;
+      } else {
+        // узлы other принадлежат чужому аллокатору, переносим значения в
+        // свои узлы той же формы
+        if (other.root_) {
+          root_ = moveTree(other.root_, nullptr);
+        }
+        other.clear();
+      }
     }
     return *this;
   }
@@ -75,7 +106,7 @@ class RBTree {
   }
 
   iterator end() const noexcept { return iterator(nullptr); }
-  const_iterator cbegin() {
+  const_iterator cbegin() const noexcept {
     // Find the leftmost node, which has the smallest key
     TreeNode* current = root_;
     while (current && current->left_) {
@@ -84,7 +115,7 @@ class RBTree {
     return const_iterator(current);
   }
 
-  const_iterator cend() {
+  const_iterator cend() const noexcept {
     // The end iterator points beyond the last node (nullptr)
     return const_iterator(nullptr);
   }
@@ -99,7 +130,7 @@ class RBTree {
         currentNode = currentNode->right_;
       } else {  // если существует такой ключ возвращаем false и текущий
                 // итератор
-        delete newNode;  // Free the memory allocated for newNode
+        destroyNode(newNode);  // Free the memory allocated for newNode
         return std::make_pair(iterator(currentNode), false);
       }
     }
@@ -140,6 +171,7 @@ class RBTree {
           if (node == parent->right_) {
             node = parent;
             rotateLeft(node);
+            parent = node->parent_;
           }
           // Устанавливаем цвета родителя и дедушки так, чтобы сохранить
           // свойства красно-черного дерева. Выполняем правый поворот
@@ -149,8 +181,8 @@ class RBTree {
           gparent->color_ = Color::RED;
           rotateRight(gparent);
         }
-      } else {
-        TreeNode* uncle = parent->parent_->left_;
+      } else if (gparent) {
+        TreeNode* uncle = gparent->left_;
         if (uncle && uncle->color_ == Color::RED) {
           uncle->color_ = Color::BLACK;
           parent->color_ = Color::BLACK;
@@ -160,11 +192,15 @@ class RBTree {
           if (node == parent->left_) {
             node = parent;
             rotateRight(node);
+            parent = node->parent_;
           }
           parent->color_ = Color::BLACK;
           gparent->color_ = Color::RED;
           rotateLeft(gparent);
         }
+      } else {
+        // родитель - красный корень, достаточно перекрасить корень ниже
+        break;
       }
     }
     root_->color_ = Color::BLACK;
@@ -222,16 +258,21 @@ class RBTree {
   // 1.когда левый ребенок - nullptr
   // 2. когда правый ребенок - nullptr
   // 3. когда никакой из детей - nullptr
-  void deleteNode(RBTree<Key, Value>& tree, TreeNode* nodeToDelete) {
+  void deleteNode(RBTree& tree, TreeNode* nodeToDelete) {
     TreeNode* successorNode = nodeToDelete;
     TreeNode* successorChild = nullptr;
-    RBTree<Key, Value>::Color successorOriginalColor = successorNode->color_;
+    // родитель successorChild нужен отдельно, потому что сам ребенок может
+    // быть nullptr (листьев-стражей в дереве нет)
+    TreeNode* childParent = nullptr;
+    Color successorOriginalColor = successorNode->color_;
 
     if (nodeToDelete->left_ == nullptr) {
       successorChild = nodeToDelete->right_;
+      childParent = nodeToDelete->parent_;
       transplant(tree, nodeToDelete, nodeToDelete->right_);
     } else if (nodeToDelete->right_ == nullptr) {
       successorChild = nodeToDelete->left_;
+      childParent = nodeToDelete->parent_;
       transplant(tree, nodeToDelete, nodeToDelete->left_);
     } else {
       successorNode = tree.minimum(nodeToDelete->right_);
@@ -239,9 +280,12 @@ class RBTree {
       successorChild = successorNode->right_;
 
       if (successorNode->parent_ != nodeToDelete) {
+        childParent = successorNode->parent_;
         transplant(tree, successorNode, successorNode->right_);
         successorNode->right_ = nodeToDelete->right_;
         successorNode->right_->parent_ = successorNode;
+      } else {
+        childParent = successorNode;
       }
 
       transplant(tree, nodeToDelete, successorNode);
@@ -250,10 +294,10 @@ class RBTree {
       successorNode->color_ = nodeToDelete->color_;
     }
 
-    delete nodeToDelete;
+    destroyNode(nodeToDelete);
     size_--;
-    if (successorOriginalColor == RBTree<Key, Value>::Color::BLACK) {
-      deleteFixup(tree, successorChild);
+    if (successorOriginalColor == Color::BLACK) {
+      deleteFixup(tree, successorChild, childParent);
     }
   }
 
@@ -263,7 +307,7 @@ class RBTree {
     }
   }
 
-  void transplant(RBTree<Key, Value>& tree, TreeNode* sourceNode,
+  void transplant(RBTree& tree, TreeNode* sourceNode,
                   TreeNode* replacementNode) {
     // Если исходный узел - корень дерева
     if (sourceNode->parent_ == nullptr) {
@@ -284,68 +328,75 @@ class RBTree {
     }
   }
 
-  void deleteFixup(RBTree<Key, Value>& tree, TreeNode* deletedNode) {
-    while (deletedNode && deletedNode != tree.root_ &&
-           deletedNode->color_ == RBTree<Key, Value>::Color::BLACK) {
-      TreeNode* sibling = (deletedNode == deletedNode->parent_->left_)
-                              ? deletedNode->parent_->right_
-                              : deletedNode->parent_->left_;
-      if (sibling == nullptr) {
-        break;
-      }
-      if (sibling->color_ == RBTree<Key, Value>::Color::RED) {
-        sibling->color_ = RBTree<Key, Value>::Color::BLACK;
-        deletedNode->parent_->color_ = RBTree<Key, Value>::Color::RED;
-        if (deletedNode == deletedNode->parent_->left_) {
-          tree.rotateLeft(deletedNode->parent_);
+  // Восстанавливает свойства дерева после удаления черного узла. deletedNode
+  // занимает место удаленного узла и может быть nullptr, поэтому его родитель
+  // передается отдельно.
+  void deleteFixup(RBTree& tree, TreeNode* deletedNode,
+                   TreeNode* parent) {
+    while (deletedNode != tree.root_ && isBlack(deletedNode) && parent) {
+      if (deletedNode == parent->left_) {
+        TreeNode* sibling = parent->right_;
+        if (isRed(sibling)) {
+          sibling->color_ = Color::BLACK;
+          parent->color_ = Color::RED;
+          tree.rotateLeft(parent);
+          sibling = parent->right_;
+        }
+        if (isBlack(sibling->left_) && isBlack(sibling->right_)) {
+          sibling->color_ = Color::RED;
+          deletedNode = parent;
+          parent = deletedNode->parent_;
         } else {
-          tree.rotateRight(deletedNode->parent_);
+          if (isBlack(sibling->right_)) {
+            sibling->left_->color_ = Color::BLACK;
+            sibling->color_ = Color::RED;
+            tree.rotateRight(sibling);
+            sibling = parent->right_;
+          }
+          sibling->color_ = parent->color_;
+          parent->color_ = Color::BLACK;
+          sibling->right_->color_ = Color::BLACK;
+          tree.rotateLeft(parent);
+          deletedNode = tree.root_;
         }
-        sibling = (deletedNode == deletedNode->parent_->left_)
-                      ? deletedNode->parent_->right_
-                      : deletedNode->parent_->left_;
-      }
-
-      if (sibling != nullptr) {
-        if ((sibling->left_ == nullptr ||
-             sibling->left_->color_ == RBTree<Key, Value>::Color::BLACK) &&
-            (sibling->right_ == nullptr ||
-             sibling->right_->color_ == RBTree<Key, Value>::Color::BLACK)) {
-          sibling->color_ = RBTree<Key, Value>::Color::RED;
-          deletedNode = deletedNode->parent_;
+      } else {
+        TreeNode* sibling = parent->left_;
+        if (isRed(sibling)) {
+          sibling->color_ = Color::BLACK;
+          parent->color_ = Color::RED;
+          tree.rotateRight(parent);
+          sibling = parent->left_;
+        }
+        if (isBlack(sibling->left_) && isBlack(sibling->right_)) {
+          sibling->color_ = Color::RED;
+          deletedNode = parent;
+          parent = deletedNode->parent_;
         } else {
-          if (sibling->right_ == nullptr ||
-              sibling->right_->color_ == RBTree<Key, Value>::Color::BLACK) {
-            sibling->left_->color_ = RBTree<Key, Value>::Color::BLACK;
-            sibling->color_ = RBTree<Key, Value>::Color::RED;
-            if (deletedNode == deletedNode->parent_->left_) {
-              tree.rotateLeft(sibling);
-            } else {
-              tree.rotateRight(sibling);
-            }
-            sibling = (deletedNode == deletedNode->parent_->left_)
-                          ? deletedNode->parent_->right_
-                          : deletedNode->parent_->left_;
-          } else {
-            sibling->right_->color_ = RBTree<Key, Value>::Color::BLACK;
-            sibling->color_ = RBTree<Key, Value>::Color::RED;
-            if (deletedNode == deletedNode->parent_->left_) {
-              tree.rotateLeft(deletedNode->parent_);
-            } else {
-              tree.rotateRight(deletedNode->parent_);
-            }
-            sibling = (deletedNode == deletedNode->parent_->left_)
-                          ? deletedNode->parent_->right_
-                          : deletedNode->parent_->left_;
+          if (isBlack(sibling->left_)) {
+            sibling->right_->color_ = Color::BLACK;
+            sibling->color_ = Color::RED;
+            tree.rotateLeft(sibling);
+            sibling = parent->left_;
           }
+          sibling->color_ = parent->color_;
+          parent->color_ = Color::BLACK;
+          sibling->left_->color_ = Color::BLACK;
+          tree.rotateRight(parent);
+          deletedNode = tree.root_;
         }
       }
     }
     if (deletedNode != nullptr) {
-      deletedNode->color_ = RBTree<Key, Value>::Color::BLACK;
+      deletedNode->color_ = Color::BLACK;
     }
   }
 
+  // nullptr считается черным листом
+  static bool isBlack(const TreeNode* node) noexcept {
+    return node == nullptr || node->color_ == Color::BLACK;
+  }
+  static bool isRed(const TreeNode* node) noexcept { return !isBlack(node); }
+
   // ищет минимальный узел в поддереве, начиная с заданного узла
   TreeNode* minimum(TreeNode* node) const {
     while (node && node->left_) {
@@ -376,7 +427,7 @@ class RBTree {
         current = current->right_;
       }
     }
-    return end();  // Узел с таким ключом не найден
+    return cend();  // Узел с таким ключом не найден
   }
   TreeIterator find(const key_type& key) {
     TreeNode* current = root_;
@@ -415,20 +466,65 @@ class RBTree {
   }
 
   value_type& operator[](const key_type& key) { return at(key); }
-  bool empty() { return size_ == 0; }
+  bool empty() const { return size_ == 0; }
 
   size_type size() const { return size_; }
 
   void clear() {
     if (root_) {
-      deleteSubtree(root_);
+      if constexpr (!can_drop_without_release_v<node_allocator, key_type,
+                                                value_type>) {
+        // с арена-аллокатором узлы не освобождаются по одному
+        deleteSubtree(root_);
+      }
       size_ = 0;
       root_ = nullptr;
     }
   }
 
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  // Узлы создаются и удаляются только через аллокатор дерева. map и set
+  // создают узлы этой функцией и передают их в insertNode.
+  template <typename... Args>
+  TreeNode* createNode(Args&&... args) {
+    TreeNode* node = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(TreeNode* node) noexcept {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  // Заменяет содержимое деревом из n пар, которые по очереди выдает next(),
+  // за O(n): без поиска места и без балансировки. Ключи должны строго
+  // возрастать. Каждое поддерево делится пополам, поэтому все пустые ссылки
+  // лежат на двух соседних уровнях; узлы неполного нижнего уровня красные,
+  // остальные черные, и черная высота у всех путей одна.
+  template <typename Source>
+  void buildSorted(size_type n, Source&& next) {
+    clear();
+    size_type full_levels = 0;
+    while (full_levels < sizeof(size_type) * 8 - 1 &&
+           (size_type(2) << full_levels) - 1 <= n) {
+      full_levels++;
+    }
+    root_ = buildRange(n, 0, full_levels, next);
+    size_ = n;
+  }
+
   void swap(RBTree& other) noexcept {
-    if (root_ != other.root_) {
+    if (this != &other) {
+      alloc_on_swap(alloc_, other.alloc_);
       std::swap(root_, other.root_);
       auto temp_size = size_;
       size_ = other.size_;
@@ -522,8 +618,8 @@ class RBTree {
     // и обеспечивают совместимость с алгоритмами, предоставляемыми STL.
     using iterator_category = std::forward_iterator_tag;
     using value_type = const RBTree::value_type;
-    using reference = RBTree::reference;
-    using pointer = const RBTree::pointer;
+    using reference = RBTree::const_reference;
+    using pointer = const RBTree::value_type*;
     using difference_type = std::ptrdiff_t;
 
    public:
@@ -546,7 +642,7 @@ class RBTree {
       return *this;
     }
 
-    const_iterator& operator++(int) noexcept {
+    const_iterator operator++(int) noexcept {
       const_iterator tmp(current_);
       ++(*this);
       return tmp;
@@ -563,7 +659,7 @@ class RBTree {
       return *this;
     }
 
-    bool operator!=(const TreeIterator& other) const noexcept {
+    bool operator!=(const ConstTreeIterator& other) const noexcept {
       return current_ != other.current_;
     }
 
@@ -571,18 +667,18 @@ class RBTree {
       return current_ == other.current_;
     }
 
-    TreeNode* operator->() const noexcept { return current_; }
+    const TreeNode* operator->() const noexcept { return current_; }
 
    private:
     const TreeNode* current_;
     // Helper function to find the leftmost node in a subtree
-    TreeNode* findLeftmost(const TreeNode* node) {
+    const TreeNode* findLeftmost(const TreeNode* node) {
       while (node && node->left_) {
         node = node->left_;
       }
       return node;
     }
-    TreeNode* findRightmost(TreeNode* node) {
+    const TreeNode* findRightmost(const TreeNode* node) {
       while (node && node->right_) {
         node = node->right_;
       }
@@ -595,15 +691,15 @@ class RBTree {
   struct TreeNode {
     // параметрический конструктор
     TreeNode(key_type key, value_type value, Color color)
-        : key_(key),
-          value_(value),
+        : key_(std::move(key)),
+          value_(std::move(value)),
           parent_(nullptr),
           left_(nullptr),
           right_(nullptr),
           color_(color){};
     TreeNode(key_type key, value_type value)
-        : key_(key),
-          value_(value),
+        : key_(std::move(key)),
+          value_(std::move(value)),
           parent_(nullptr),
           left_(nullptr),
           right_(nullptr),
@@ -615,11 +711,16 @@ class RBTree {
     TreeNode* left_ = nullptr;
     TreeNode* right_ = nullptr;
     Color color_ = Color::RED;
-    friend class RBTree<Key, Value>;
+    friend class RBTree;
   };
 
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<TreeNode>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
   TreeNode* root_;
   size_type size_ = 0;
+  node_allocator alloc_;
 
   TreeNode* copyTree(const TreeNode* srcNode, TreeNode* parent) {
     if (!srcNode) {
@@ -628,7 +729,7 @@ class RBTree {
     // создаем новый узел дерева через парам конструктор с теми же значениями
     // что в передаваемом узле
     TreeNode* newNode =
-        new TreeNode(srcNode->key_, srcNode->value_, srcNode->color_);
+        createNode(srcNode->key_, srcNode->value_, srcNode->color_);
     newNode->parent_ = parent;
     // рекурсивно копируем левое и правое поддерево
     newNode->left_ = copyTree(srcNode->left_, newNode);
@@ -637,13 +738,62 @@ class RBTree {
     return newNode;
   }
 
+  // Как copyTree, но ключи и значения переносятся из srcNode
+  TreeNode* moveTree(TreeNode* srcNode, TreeNode* parent) {
+    if (!srcNode) {
+      return nullptr;
+    }
+    TreeNode* newNode = createNode(std::move(srcNode->key_),
+                                   std::move(srcNode->value_), srcNode->color_);
+    newNode->parent_ = parent;
+    newNode->left_ = moveTree(srcNode->left_, newNode);
+    newNode->right_ = moveTree(srcNode->right_, newNode);
+    ++size_;
+    return newNode;
+  }
+
+  // Строит поддерево из n следующих пар. Если next() или аллокатор бросят
+  // исключение, уже созданные узлы поддерева удаляются.
+  template <typename Source>
+  TreeNode* buildRange(size_type n, size_type depth, size_type red_depth,
+                       Source& next) {
+    if (n == 0) {
+      return nullptr;
+    }
+    size_type left_size = n / 2;
+    TreeNode* left = buildRange(left_size, depth + 1, red_depth, next);
+    TreeNode* node = nullptr;
+    try {
+      auto item = next();
+      node = createNode(std::move(item.first), std::move(item.second),
+                        depth >= red_depth ? Color::RED : Color::BLACK);
+    } catch (...) {
+      deleteSubtree(left);
+      throw;
+    }
+    node->left_ = left;
+    if (left) {
+      left->parent_ = node;
+    }
+    try {
+      node->right_ = buildRange(n - left_size - 1, depth + 1, red_depth, next);
+    } catch (...) {
+      deleteSubtree(node);
+      throw;
+    }
+    if (node->right_) {
+      node->right_->parent_ = node;
+    }
+    return node;
+  }
+
   void deleteSubtree(TreeNode* node) {
     if (node) {
       // Рекурсивно вызываем удаление для левого и правого поддерева
       deleteSubtree(node->left_);
       deleteSubtree(node->right_);
       // Удаляем текущий узел
-      delete node;
+      destroyNode(node);
     }
   }
 };
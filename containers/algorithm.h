@@ -0,0 +1,164 @@
+#ifndef CONTAINERS_ALGORITHM_H
+#define CONTAINERS_ALGORITHM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "simd.h"
+
+// Алгоритмы стандартной библиотеки становятся constexpr только в C++20,
+// а таблицы (CRC, перестановки) хочется строить при компиляции уже в C++17.
+// Здесь constexpr-версии fill, find, sort и transform над итераторами:
+//
+//   constexpr auto kSorted = [] {
+//     s21::array<int, 4> a = {3, 1, 4, 1};
+//     s21::sort(a.begin(), a.end());
+//     return a;
+//   }();
+//
+// Во время выполнения они не медленнее обычных: fill и find над
+// указателями уходят в ядра s21::simd, sort - в std::sort. Ветка выбирается
+// через __builtin_is_constant_evaluated (GCC 9+, Clang 9+); без него
+// всегда работает constexpr-ветка.
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define S21_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#ifndef S21_IS_CONSTANT_EVALUATED
+#define S21_IS_CONSTANT_EVALUATED() true
+#endif
+
+namespace s21 {
+
+namespace detail {
+
+// std::swap - constexpr только с C++20
+template <typename T>
+constexpr void swap_values(T &a, T &b) {
+  T tmp = std::move(a);
+  a = std::move(b);
+  b = std::move(tmp);
+}
+
+// Указатель, с элементами которого работают ядра s21::simd
+template <typename It, typename T>
+constexpr bool is_simd_range_v =
+    std::is_pointer<It>::value &&
+    std::is_same<std::remove_cv_t<std::remove_pointer_t<It>>, T>::value;
+
+template <typename It, typename Compare>
+constexpr void insertion_sort(It first, It last, Compare &comp) {
+  for (It i = first; i != last; ++i) {
+    for (It j = i; j != first && comp(*j, *(j - 1)); --j) {
+      swap_values(*j, *(j - 1));
+    }
+  }
+}
+
+template <typename It, typename Compare>
+constexpr void sift_down(It first, std::ptrdiff_t root, std::ptrdiff_t n,
+                         Compare &comp) {
+  for (;;) {
+    std::ptrdiff_t child = 2 * root + 1;
+    if (child >= n) {
+      return;
+    }
+    if (child + 1 < n && comp(first[child], first[child + 1])) {
+      child++;
+    }
+    if (!comp(first[root], first[child])) {
+      return;
+    }
+    swap_values(first[root], first[child]);
+    root = child;
+  }
+}
+
+// Пирамидальная сортировка: O(n log n) без рекурсии, что важно для
+// лимитов вычислений при компиляции
+template <typename It, typename Compare>
+constexpr void heap_sort(It first, It last, Compare &comp) {
+  std::ptrdiff_t n = last - first;
+  for (std::ptrdiff_t root = n / 2 - 1; root >= 0; root--) {
+    sift_down(first, root, n, comp);
+  }
+  for (std::ptrdiff_t end = n - 1; end > 0; end--) {
+    swap_values(first[0], first[end]);
+    sift_down(first, 0, end, comp);
+  }
+}
+
+}  // namespace detail
+
+template <typename It, typename T>
+constexpr void fill(It first, It last, const T &value) {
+  if constexpr (detail::is_simd_range_v<It, T>) {
+    if (!S21_IS_CONSTANT_EVALUATED()) {
+      simd::detail::fill(first, static_cast<std::size_t>(last - first), value);
+      return;
+    }
+  }
+  for (; first != last; ++first) {
+    *first = value;
+  }
+}
+
+// Первый элемент, равный value, или last
+template <typename It, typename T>
+constexpr It find(It first, It last, const T &value) {
+  if constexpr (detail::is_simd_range_v<It, T>) {
+    if (!S21_IS_CONSTANT_EVALUATED()) {
+      return first + simd::detail::find<std::remove_cv_t<T>>(
+                         first, static_cast<std::size_t>(last - first), value);
+    }
+  }
+  for (; first != last; ++first) {
+    if (*first == value) {
+      return first;
+    }
+  }
+  return last;
+}
+
+// Неустойчивая сортировка итераторов произвольного доступа
+template <typename It, typename Compare = std::less<>>
+constexpr void sort(It first, It last, Compare comp = Compare()) {
+  if (!S21_IS_CONSTANT_EVALUATED()) {
+    std::sort(first, last, comp);
+  } else if (last - first <= 16) {
+    detail::insertion_sort(first, last, comp);
+  } else {
+    detail::heap_sort(first, last, comp);
+  }
+}
+
+// out[i] = op(in[i]); возвращает конец записанного
+template <typename InputIt, typename OutputIt, typename Op>
+constexpr OutputIt transform(InputIt first, InputIt last, OutputIt out,
+                             Op op) {
+  for (; first != last; ++first, ++out) {
+    *out = op(*first);
+  }
+  return out;
+}
+
+// out[i] = op(a[i], b[i])
+template <typename InputIt1, typename InputIt2, typename OutputIt,
+          typename Op>
+constexpr OutputIt transform(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                             OutputIt out, Op op) {
+  for (; first1 != last1; ++first1, ++first2, ++out) {
+    *out = op(*first1, *first2);
+  }
+  return out;
+}
+
+}  // namespace s21
+
+#endif  // CONTAINERS_ALGORITHM_H
@@ -0,0 +1,213 @@
+#ifndef CONTAINERS_ALIGNED_ALLOCATOR_H
+#define CONTAINERS_ALIGNED_ALLOCATOR_H
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include "vector.h"
+
+// Блоки не меньше S21_HUGE_PAGE_THRESHOLD байт huge_page_allocator берет
+// прямо у ядра через mmap и просит прозрачные огромные страницы
+#ifndef S21_HUGE_PAGE_THRESHOLD
+#define S21_HUGE_PAGE_THRESHOLD (std::size_t(2) << 20)
+#endif
+
+namespace s21 {
+
+// Аллокатор с выравниванием блоков на Align байт (по умолчанию на строку
+// кэша), например для выровненных AVX-загрузок из s21::simd:
+//
+//   s21::aligned_vector<float, 32> v(n);
+template <typename T, std::size_t Align = 64>
+class aligned_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  static_assert((Align & (Align - 1)) == 0, "alignment must be a power of 2");
+  static_assert(Align >= alignof(T), "alignment is weaker than alignof(T)");
+
+  // Align не выводится из T, поэтому rebind задается явно
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Align>;
+  };
+
+  aligned_allocator() noexcept = default;
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(Align)));
+  }
+
+  void deallocate(T *p, std::size_t) noexcept {
+    ::operator delete(p, std::align_val_t(Align));
+  }
+
+  template <typename U>
+  bool operator==(const aligned_allocator<U, Align> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const aligned_allocator<U, Align> &) const noexcept {
+    return false;
+  }
+};
+
+// Аллокатор для больших массивов со случайным доступом. Блоки от Threshold
+// байт выделяются через mmap, выравниваются на огромную страницу (2 МиБ) и
+// помечаются MADV_HUGEPAGE: одна запись TLB покрывает 2 МиБ вместо 4 КиБ,
+// и промахов TLB становится на порядки меньше. Освобождаются они через
+// munmap. Блоки меньше порога идут через aligned_allocator.
+//
+// reallocate() переносит большие блоки через mremap без копирования страниц,
+// сохраняя выравнивание на 2 МиБ (вектор тривиально переносимых элементов
+// пользуется им при росте).
+// Как и malloc_allocator, память из mmap не видна alloc_tracker.
+template <typename T, std::size_t Align = 64,
+          std::size_t Threshold = S21_HUGE_PAGE_THRESHOLD>
+class huge_page_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  static constexpr std::size_t kHugePageBytes = std::size_t(2) << 20;
+
+  static_assert(Align <= 4096, "mmap only guarantees page alignment");
+
+  template <typename U>
+  struct rebind {
+    using other = huge_page_allocator<U, Align, Threshold>;
+  };
+
+  huge_page_allocator() noexcept = default;
+  template <typename U>
+  huge_page_allocator(
+      const huge_page_allocator<U, Align, Threshold> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    if (!is_huge(n)) {
+      return small_allocator().allocate(n);
+    }
+    std::size_t bytes = mapped_bytes(n);
+    void *p = map_aligned(bytes);
+    advise(p, bytes);
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept {
+    if (!is_huge(n)) {
+      small_allocator().deallocate(p, n);
+    } else {
+      ::munmap(p, mapped_bytes(n));
+    }
+  }
+
+  // Только для тривиально переносимых T: содержимое переносится побайтово.
+  // Результат, как и у allocate, выровнен на огромную страницу: mremap с
+  // MREMAP_MAYMOVE выбрал бы адрес сам, с выравниванием лишь на 4 КиБ,
+  // поэтому блок либо растет на месте, либо его страницы переезжают в
+  // заранее выровненное окно (MREMAP_FIXED), и только иначе копируются.
+  T *reallocate(T *p, std::size_t old_n, std::size_t new_n) {
+#ifdef MREMAP_MAYMOVE
+    bool remap = is_huge(old_n) && is_huge(new_n);
+    if (remap) {
+      std::size_t old_bytes = mapped_bytes(old_n);
+      std::size_t new_bytes = mapped_bytes(new_n);
+      if (::mremap(p, old_bytes, new_bytes, 0) != MAP_FAILED) {
+        advise(p, new_bytes);
+        return p;
+      }
+    }
+#endif
+    T *result = allocate(new_n);
+#if defined(MREMAP_MAYMOVE) && defined(MREMAP_FIXED)
+    if (remap) {
+      std::size_t new_bytes = mapped_bytes(new_n);
+      if (::mremap(p, mapped_bytes(old_n), new_bytes,
+                   MREMAP_MAYMOVE | MREMAP_FIXED, result) != MAP_FAILED) {
+        advise(result, new_bytes);
+        return result;
+      }
+    }
+#endif
+    std::memcpy(static_cast<void *>(result), p,
+                (old_n < new_n ? old_n : new_n) * sizeof(T));
+    deallocate(p, old_n);
+    return result;
+  }
+
+  template <typename U>
+  bool operator==(
+      const huge_page_allocator<U, Align, Threshold> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(
+      const huge_page_allocator<U, Align, Threshold> &) const noexcept {
+    return false;
+  }
+
+ private:
+  using small_allocator = aligned_allocator<T, Align>;
+
+  static bool is_huge(std::size_t n) noexcept {
+    return n * sizeof(T) >= Threshold;
+  }
+
+  static std::size_t mapped_bytes(std::size_t n) noexcept {
+    return (n * sizeof(T) + kHugePageBytes - 1) / kHugePageBytes *
+           kHugePageBytes;
+  }
+
+  // Отображение из bytes байт с началом на границе огромной страницы
+  static void *map_aligned(std::size_t bytes) {
+    // лишние 2 МиБ, чтобы вырезать из отображения выровненный кусок
+    void *raw = ::mmap(nullptr, bytes + kHugePageBytes, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    char *start = static_cast<char *>(raw);
+    char *aligned = start + (kHugePageBytes -
+                             reinterpret_cast<std::uintptr_t>(start) %
+                                 kHugePageBytes) %
+                                kHugePageBytes;
+    if (aligned != start) {
+      ::munmap(start, aligned - start);
+    }
+    std::size_t tail = (start + bytes + kHugePageBytes) - (aligned + bytes);
+    if (tail > 0) {
+      ::munmap(aligned + bytes, tail);
+    }
+    return aligned;
+  }
+
+  static void advise(void *p, std::size_t bytes) noexcept {
+#ifdef MADV_HUGEPAGE
+    // подсказка: без поддержки THP в ядре память просто останется на
+    // обычных страницах
+    ::madvise(p, bytes, MADV_HUGEPAGE);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+  }
+};
+
+template <typename T, std::size_t Align = 64>
+using aligned_vector = vector<T, aligned_allocator<T, Align>>;
+
+template <typename T, std::size_t Align = 64>
+using huge_page_vector = vector<T, huge_page_allocator<T, Align>>;
+
+}  // namespace s21
+
+#endif  // CONTAINERS_ALIGNED_ALLOCATOR_H
@@ -0,0 +1,172 @@
+#ifndef CONTAINERS_ARENA_H
+#define CONTAINERS_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Арена с выделением "сдвигом указателя". Память не возвращается по одному
+// объекту: reset() за O(1) перематывает арену на начало, а блоки остаются
+// для следующего использования. Освобождаются блоки только в деструкторе.
+//
+// Типичный сценарий - короткоживущие контейнеры одного запроса:
+//   {
+//     s21::list<int, s21::arena_allocator<int>> l;
+//     ...
+//   }
+//   s21::arena::local().reset();
+// После reset() все, что было выделено в арене, становится недействительным.
+class arena {
+ public:
+  static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+  explicit arena(std::size_t block_size = kDefaultBlockSize) noexcept
+      : block_size_(block_size) {}
+
+  arena(const arena &) = delete;
+  arena &operator=(const arena &) = delete;
+
+  ~arena() {
+    Block *block = first_;
+    while (block != nullptr) {
+      Block *next = block->next;
+      ::operator delete(block);
+      block = next;
+    }
+  }
+
+  void *allocate(std::size_t bytes, std::size_t align) {
+    char *p = align_up(cursor_, align);
+    if (p == nullptr || bytes > static_cast<std::size_t>(limit_ - p)) {
+      // блок с заголовком и запасом на выравнивание не должен переполнить
+      // size_t
+      if (bytes > std::numeric_limits<std::size_t>::max() - align -
+                      sizeof(Block)) {
+        throw std::bad_alloc();
+      }
+      next_block(bytes + align);
+      p = align_up(cursor_, align);
+    }
+    cursor_ = p + bytes;
+    used_ += bytes;
+    return p;
+  }
+
+  // Забывает все выделенное, блоки переиспользуются
+  void reset() noexcept {
+    current_ = first_;
+    if (current_ != nullptr) {
+      cursor_ = current_->data();
+      limit_ = cursor_ + current_->size;
+    }
+    used_ = 0;
+  }
+
+  // Сколько байт выдано с последнего reset()
+  std::size_t bytes_used() const noexcept { return used_; }
+
+  // Сколько байт арена держит в блоках
+  std::size_t bytes_reserved() const noexcept {
+    std::size_t total = 0;
+    for (Block *block = first_; block != nullptr; block = block->next) {
+      total += block->size;
+    }
+    return total;
+  }
+
+  // Своя арена у каждого потока
+  static arena &local() {
+    static thread_local arena instance;
+    return instance;
+  }
+
+ private:
+  struct Block {
+    Block *next;
+    std::size_t size;
+    char *data() noexcept { return reinterpret_cast<char *>(this + 1); }
+  };
+
+  static char *align_up(char *p, std::size_t align) noexcept {
+    if (p == nullptr) {
+      return nullptr;
+    }
+    std::uintptr_t value = reinterpret_cast<std::uintptr_t>(p);
+    return reinterpret_cast<char *>((value + align - 1) & ~(align - 1));
+  }
+
+  // Переходит к следующему блоку, в который поместится need байт. Блоки после
+  // reset() используются повторно, новый вставляется сразу за текущим.
+  void next_block(std::size_t need) {
+    Block *next = current_ != nullptr ? current_->next : first_;
+    if (next == nullptr || next->size < need) {
+      std::size_t size = need > block_size_ ? need : block_size_;
+      Block *block = static_cast<Block *>(::operator new(sizeof(Block) + size));
+      block->size = size;
+      block->next = next;
+      if (current_ != nullptr) {
+        current_->next = block;
+      } else {
+        first_ = block;
+      }
+      next = block;
+    }
+    current_ = next;
+    cursor_ = current_->data();
+    limit_ = cursor_ + current_->size;
+  }
+
+  std::size_t block_size_;
+  Block *first_ = nullptr;
+  Block *current_ = nullptr;
+  char *cursor_ = nullptr;
+  char *limit_ = nullptr;
+  std::size_t used_ = 0;
+};
+
+// Аллокатор поверх арены. По умолчанию берет арену текущего потока.
+// deallocate ничего не делает, память возвращается через arena::reset().
+template <typename T>
+class arena_allocator {
+ public:
+  using value_type = T;
+  // контейнеры могут не обходить узлы при уничтожении (см. memory.h)
+  using releases_in_bulk = std::true_type;
+
+  arena_allocator() noexcept : arena_(&arena::local()) {}
+  explicit arena_allocator(arena &a) noexcept : arena_(&a) {}
+  template <typename U>
+  arena_allocator(const arena_allocator<U> &other) noexcept
+      : arena_(other.get_arena()) {}
+
+  T *allocate(std::size_t n) {
+    // как у std::allocator: n * sizeof(T) не должно переполниться
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, std::size_t) noexcept {}
+
+  arena *get_arena() const noexcept { return arena_; }
+
+  template <typename U>
+  bool operator==(const arena_allocator<U> &other) const noexcept {
+    return arena_ == other.get_arena();
+  }
+  template <typename U>
+  bool operator!=(const arena_allocator<U> &other) const noexcept {
+    return arena_ != other.get_arena();
+  }
+
+ private:
+  arena *arena_;
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_ARENA_H
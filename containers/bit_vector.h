@@ -0,0 +1,684 @@
+#ifndef CONTAINERS_BIT_VECTOR_H
+#define CONTAINERS_BIT_VECTOR_H
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "vector.h"
+
+namespace s21 {
+
+namespace detail {
+// Без -mpopcnt __builtin_popcountll - это вызов библиотечной функции,
+// поэтому подсчет по словам выбирает инструкцию popcnt при запуске
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("popcnt"))) inline std::size_t popcount_words_hw(
+    const std::uint64_t *words, std::size_t n) noexcept {
+  std::size_t result = 0;
+  for (std::size_t i = 0; i < n; i++) {
+    result += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+  }
+  return result;
+}
+#endif
+
+inline std::size_t popcount_words(const std::uint64_t *words,
+                                  std::size_t n) noexcept {
+#if defined(__GNUC__) && defined(__x86_64__)
+  static const bool has_popcnt = __builtin_cpu_supports("popcnt");
+  if (has_popcnt) {
+    return popcount_words_hw(words, n);
+  }
+#endif
+  std::size_t result = 0;
+  for (std::size_t i = 0; i < n; i++) {
+    result += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+  }
+  return result;
+}
+}  // namespace detail
+
+// s21::vector<bool> хранит флаги упакованными по 64 в слове uint64_t:
+// миллиард флагов занимает 125 МБ, а не гигабайт. Как и у
+// std::vector<bool>, operator[] возвращает прокси-ссылку на бит, а
+// указателя на отдельный bool нет.
+//
+// Массовые операции идут по словам: count (popcount), &=, |=, ^=,
+// flip, поиск установленных битов find_first/find_next и обход
+// for_each_set через подсчет хвостовых нулей (tzcnt). Биты последнего
+// слова за size() всегда нулевые, поэтому подсчеты их не маскируют.
+// insert и erase сдвигают хвост тоже словами, по 64 бита за шаг, так что
+// интерфейс изменения тот же, что у остальных s21::vector.
+template <typename Allocator>
+class vector<bool, Allocator> {
+ public:
+  using word_type = std::uint64_t;
+
+ private:
+  using word_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<word_type>;
+  using words_type = vector<word_type, word_allocator>;
+
+  static constexpr std::size_t kWordBits =
+      std::numeric_limits<word_type>::digits;
+
+  template <bool Const>
+  class BitIterator;
+
+ public:
+  class reference;
+
+  using value_type = bool;
+  using allocator_type = Allocator;
+  using const_reference = bool;
+  using iterator = BitIterator<false>;
+  using const_iterator = BitIterator<true>;
+  using size_type = size_t;
+
+  // Результат поиска, когда подходящего бита нет
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+  vector() : vector(Allocator()) {}
+
+  explicit vector(const Allocator &alloc)
+      : words_(word_allocator(alloc)), size_(0) {}
+
+  explicit vector(size_type n, bool value = false,
+                  const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    resize(n, value);
+  }
+
+  vector(std::initializer_list<bool> const &items,
+         const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    reserve(items.size());
+    for (bool item : items) {
+      push_back(item);
+    }
+  }
+
+  vector(const vector &v) = default;
+  vector(const vector &v, const Allocator &alloc)
+      : words_(v.words_, word_allocator(alloc)), size_(v.size_) {}
+  vector(vector &&v) noexcept : words_(std::move(v.words_)), size_(v.size_) {
+    v.size_ = 0;
+  }
+  vector(vector &&v, const Allocator &alloc)
+      : words_(std::move(v.words_), word_allocator(alloc)), size_(v.size_) {
+    v.words_.clear();
+    v.size_ = 0;
+  }
+  vector &operator=(const vector &v) = default;
+  vector &operator=(vector &&v) {
+    if (this != &v) {
+      words_ = std::move(v.words_);
+      size_ = v.size_;
+      v.words_.clear();
+      v.size_ = 0;
+    }
+    return *this;
+  }
+  ~vector() = default;
+
+  // Прокси-ссылка на один бит
+  class reference {
+   public:
+    reference(word_type *word, word_type mask) noexcept
+        : word_(word), mask_(mask) {}
+    reference(const reference &) = default;
+
+    operator bool() const noexcept { return (*word_ & mask_) != 0; }
+    reference &operator=(bool value) noexcept {
+      if (value) {
+        *word_ |= mask_;
+      } else {
+        *word_ &= ~mask_;
+      }
+      return *this;
+    }
+    reference &operator=(const reference &other) noexcept {
+      return *this = static_cast<bool>(other);
+    }
+    bool operator~() const noexcept { return !static_cast<bool>(*this); }
+    reference &flip() noexcept {
+      *word_ ^= mask_;
+      return *this;
+    }
+
+   private:
+    word_type *word_;
+    word_type mask_;
+  };
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return bit(pos);
+  }
+  bool at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return test(pos);
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "vector index out of range");
+    return bit(pos);
+  }
+  bool operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "vector index out of range");
+    return test(pos);
+  }
+  bool front() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return test(0);
+  }
+  bool back() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return test(size_ - 1);
+  }
+
+  // Слова с битами: бит i лежит в слове i / 64 на месте i % 64. data() нет
+  // намеренно: обобщенный код над непрерывными контейнерами (s21::simd,
+  // s21::parallel) прочитал бы size() слов вместо size() битов
+  word_type *words() noexcept { return words_.data(); }
+  const word_type *words() const noexcept { return words_.data(); }
+  size_type word_count() const noexcept { return words_.size(); }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(words_.get_allocator());
+  }
+
+  iterator begin() noexcept { return iterator(words_.data(), 0); }
+  iterator end() noexcept { return iterator(words_.data(), size_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(words_.data(), 0);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(words_.data(), size_);
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept {
+    return words_.capacity() * kWordBits;
+  }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() - kWordBits;
+  }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    words_.reserve(words_for(new_capacity));
+  }
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  void push_back(bool value) {
+    if (size_ % kWordBits == 0) {
+      words_.push_back(0);
+    }
+    if (value) {
+      words_[size_ / kWordBits] |= mask_of(size_);
+    }
+    size_++;
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      size_--;
+      words_[size_ / kWordBits] &= ~mask_of(size_);
+      if (size_ % kWordBits == 0) {
+        words_.pop_back();
+      }
+    }
+  }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    push_back(value_type(std::forward<Args>(args)...));
+    return bit(size_ - 1);
+  }
+
+  iterator insert(const_iterator pos, bool value) {
+    return insert(pos, 1, value);
+  }
+
+  // Вставляет n битов value: хвост сдвигается целыми словами один раз
+  iterator insert(const_iterator pos, size_type n, bool value) {
+    size_type offset = open_gap(pos, n);
+    fill_bits(offset, n, value);
+    return iterator(words_.data(), offset);
+  }
+
+  // Диапазон не должен указывать внутрь этого же вектора
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      InputIt>::iterator_category>::value) {
+      size_type offset = open_gap(pos, std::distance(first, last));
+      for (size_type i = offset; first != last; ++first, ++i) {
+        set(i, static_cast<bool>(*first));
+      }
+      return iterator(words_.data(), offset);
+    } else {
+      // длину однопроходного диапазона заранее не узнать
+      vector items(get_allocator());
+      for (; first != last; ++first) {
+        items.push_back(static_cast<bool>(*first));
+      }
+      return insert(pos, items.begin(), items.end());
+    }
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<bool> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    return insert(pos, 1, value_type(std::forward<Args>(args)...));
+  }
+
+  // Вставляет перед pos по биту на каждый аргумент
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    if constexpr (sizeof...(Args) == 0) {
+      return iterator(words_.data(), pos.pos_);
+    } else {
+      return insert(pos, {static_cast<bool>(std::forward<Args>(args))...});
+    }
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+  }
+
+  iterator erase(const_iterator pos) {
+    if (pos.pos_ >= size_) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    return erase(pos, pos + 1);
+  }
+
+  // Удаляет [first, last), хвост сдвигается целыми словами один раз
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type offset = first.pos_;
+    size_type stop = last.pos_;
+    if (offset > stop || stop > size_) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    move_bits(stop, offset, size_ - stop);
+    resize(size_ - (stop - offset));
+    return iterator(words_.data(), offset);
+  }
+
+  void assign(size_type n, bool value) {
+    clear();
+    resize(n, value);
+  }
+
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    insert(begin(), first, last);
+  }
+
+  void assign(std::initializer_list<bool> items) {
+    assign(items.begin(), items.end());
+  }
+
+  void resize(size_type n, bool value = false) {
+    if (n > max_size()) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    size_type old_size = size_;
+    words_.resize(words_for(n), value ? ~word_type(0) : 0);
+    if (value && n > old_size && old_size % kWordBits != 0) {
+      // хвост старого последнего слова был нулевым
+      words_[old_size / kWordBits] |= ~word_type(0)
+                                      << (old_size % kWordBits);
+    }
+    size_ = n;
+    clear_tail();
+  }
+
+  void swap(vector &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  bool test(size_type pos) const noexcept {
+    return (words_[pos / kWordBits] & mask_of(pos)) != 0;
+  }
+  void set(size_type pos, bool value = true) noexcept { bit(pos) = value; }
+  void reset(size_type pos) noexcept { bit(pos) = false; }
+  void flip(size_type pos) noexcept { bit(pos).flip(); }
+
+  // Инвертирует все биты
+  void flip() noexcept {
+    for (word_type &word : words_) {
+      word = ~word;
+    }
+    clear_tail();
+  }
+
+  // Число установленных битов
+  size_type count() const noexcept {
+    return detail::popcount_words(words_.data(), words_.size());
+  }
+  bool any() const noexcept {
+    for (size_type i = 0; i < words_.size(); i++) {
+      if (words_[i] != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+  bool none() const noexcept { return !any(); }
+  bool all() const noexcept { return count() == size_; }
+
+  // Побитовые операции с вектором того же размера
+  vector &operator&=(const vector &other) {
+    check_same_size(other);
+    for (size_type i = 0; i < words_.size(); i++) {
+      words_[i] &= other.words_[i];
+    }
+    return *this;
+  }
+  vector &operator|=(const vector &other) {
+    check_same_size(other);
+    for (size_type i = 0; i < words_.size(); i++) {
+      words_[i] |= other.words_[i];
+    }
+    return *this;
+  }
+  vector &operator^=(const vector &other) {
+    check_same_size(other);
+    for (size_type i = 0; i < words_.size(); i++) {
+      words_[i] ^= other.words_[i];
+    }
+    return *this;
+  }
+
+  // Индекс первого установленного бита или npos
+  size_type find_first() const noexcept { return find_from(0); }
+
+  // Индекс первого установленного бита после pos или npos
+  size_type find_next(size_type pos) const noexcept {
+    return pos + 1 >= size_ ? npos : find_from(pos + 1);
+  }
+
+  // Вызывает f(index) для каждого установленного бита по возрастанию
+  template <typename F>
+  void for_each_set(F f) const {
+    for (size_type i = 0; i < words_.size(); i++) {
+      word_type word = words_[i];
+      while (word != 0) {
+        f(i * kWordBits + static_cast<size_type>(__builtin_ctzll(word)));
+        // снимает младший установленный бит
+        word &= word - 1;
+      }
+    }
+  }
+
+  bool operator==(const vector &other) const noexcept {
+    if (size_ != other.size_) {
+      return false;
+    }
+    for (size_type i = 0; i < words_.size(); i++) {
+      if (words_[i] != other.words_[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+  bool operator!=(const vector &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  words_type words_;
+  size_type size_;
+
+  static size_type words_for(size_type bits) noexcept {
+    return (bits + kWordBits - 1) / kWordBits;
+  }
+  static word_type mask_of(size_type pos) noexcept {
+    return word_type(1) << (pos % kWordBits);
+  }
+
+  reference bit(size_type pos) noexcept {
+    return reference(words_.data() + pos / kWordBits, mask_of(pos));
+  }
+
+  // Обнуляет биты последнего слова за size_
+  void clear_tail() noexcept {
+    if (size_ % kWordBits != 0) {
+      words_[size_ / kWordBits] &= ~(~word_type(0) << (size_ % kWordBits));
+    }
+  }
+
+  // Читает len <= 64 битов, начиная с pos, в младшие биты слова
+  word_type load_bits(size_type pos, size_type len) const noexcept {
+    size_type i = pos / kWordBits;
+    size_type shift = pos % kWordBits;
+    word_type bits = words_[i] >> shift;
+    if (shift + len > kWordBits) {
+      bits |= words_[i + 1] << (kWordBits - shift);
+    }
+    return len < kWordBits ? bits & ((word_type(1) << len) - 1) : bits;
+  }
+
+  // Записывает младшие len <= 64 битов bits, начиная с pos
+  void store_bits(size_type pos, size_type len, word_type bits) noexcept {
+    word_type mask = len < kWordBits ? (word_type(1) << len) - 1 : ~word_type(0);
+    bits &= mask;
+    size_type i = pos / kWordBits;
+    size_type shift = pos % kWordBits;
+    words_[i] = (words_[i] & ~(mask << shift)) | (bits << shift);
+    if (shift + len > kWordBits) {
+      size_type high = kWordBits - shift;
+      words_[i + 1] = (words_[i + 1] & ~(mask >> high)) | (bits >> high);
+    }
+  }
+
+  // Переносит count битов с src на dst по 64 за раз. Области могут
+  // пересекаться: при сдвиге вверх копирование идет с конца.
+  void move_bits(size_type src, size_type dst, size_type count) noexcept {
+    if (dst > src) {
+      while (count > 0) {
+        size_type len = count < kWordBits ? count : kWordBits;
+        count -= len;
+        store_bits(dst + count, len, load_bits(src + count, len));
+      }
+    } else if (dst < src) {
+      for (size_type done = 0; done < count;) {
+        size_type len = count - done < kWordBits ? count - done : kWordBits;
+        store_bits(dst + done, len, load_bits(src + done, len));
+        done += len;
+      }
+    }
+  }
+
+  void fill_bits(size_type pos, size_type n, bool value) noexcept {
+    word_type bits = value ? ~word_type(0) : 0;
+    for (size_type done = 0; done < n;) {
+      size_type len = n - done < kWordBits ? n - done : kWordBits;
+      store_bits(pos + done, len, bits);
+      done += len;
+    }
+  }
+
+  // Раздвигает биты перед pos на n мест, возвращает номер pos
+  size_type open_gap(const_iterator pos, size_type n) {
+    size_type offset = pos.pos_;
+    if (offset > size_) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    if (n > max_size() - size_) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    size_type tail = size_ - offset;
+    resize(size_ + n);
+    move_bits(offset, offset + n, tail);
+    return offset;
+  }
+
+  void check_same_size(const vector &other) const {
+    if (size_ != other.size_) {
+      throw std::invalid_argument("vector<bool>: sizes differ");
+    }
+  }
+
+  size_type find_from(size_type pos) const noexcept {
+    if (pos >= size_) {
+      return npos;
+    }
+    size_type i = pos / kWordBits;
+    // биты до pos в первом слове не смотрим
+    word_type word = words_[i] & (~word_type(0) << (pos % kWordBits));
+    while (true) {
+      if (word != 0) {
+        return i * kWordBits + static_cast<size_type>(__builtin_ctzll(word));
+      }
+      if (++i == words_.size()) {
+        return npos;
+      }
+      word = words_[i];
+    }
+  }
+
+  // Итератор произвольного доступа по битам: слово и номер бита
+  template <bool Const>
+  class BitIterator {
+    using word_pointer =
+        std::conditional_t<Const, const word_type *, word_type *>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bool;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference =
+        std::conditional_t<Const, bool, typename vector::reference>;
+
+    BitIterator() noexcept : words_(nullptr), pos_(0) {}
+    BitIterator(word_pointer words, size_type pos) noexcept
+        : words_(words), pos_(pos) {}
+    // iterator -> const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    BitIterator(const BitIterator<false> &other) noexcept
+        : words_(other.words_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept {
+      if constexpr (Const) {
+        return (words_[pos_ / kWordBits] & mask_of(pos_)) != 0;
+      } else {
+        return reference(words_ + pos_ / kWordBits, mask_of(pos_));
+      }
+    }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    BitIterator &operator++() noexcept {
+      pos_++;
+      return *this;
+    }
+    BitIterator operator++(int) noexcept {
+      BitIterator tmp(*this);
+      pos_++;
+      return tmp;
+    }
+    BitIterator &operator--() noexcept {
+      pos_--;
+      return *this;
+    }
+    BitIterator operator--(int) noexcept {
+      BitIterator tmp(*this);
+      pos_--;
+      return tmp;
+    }
+    BitIterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    BitIterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    friend BitIterator operator+(BitIterator it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend BitIterator operator+(difference_type n, BitIterator it) noexcept {
+      return it += n;
+    }
+    friend BitIterator operator-(BitIterator it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const BitIterator &a,
+                                     const BitIterator &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+
+    bool operator==(const BitIterator &other) const noexcept {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const BitIterator &other) const noexcept {
+      return pos_ != other.pos_;
+    }
+    bool operator<(const BitIterator &other) const noexcept {
+      return pos_ < other.pos_;
+    }
+    bool operator>(const BitIterator &other) const noexcept {
+      return pos_ > other.pos_;
+    }
+    bool operator<=(const BitIterator &other) const noexcept {
+      return pos_ <= other.pos_;
+    }
+    bool operator>=(const BitIterator &other) const noexcept {
+      return pos_ >= other.pos_;
+    }
+
+   private:
+    friend class BitIterator<!Const>;
+    friend class vector;
+
+    word_pointer words_;
+    size_type pos_;
+  };
+};
+
+// Короткое имя для упакованного вектора битов
+using bit_vector = vector<bool>;
+
+}  // namespace s21
+
+#endif  // CONTAINERS_BIT_VECTOR_H
@@ -0,0 +1,468 @@
+#ifndef CONTAINERS_CONCURRENT_VECTOR_H
+#define CONTAINERS_CONCURRENT_VECTOR_H
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "segmented_vector.h"
+
+namespace s21 {
+
+// Вектор, в конец которого могут одновременно добавлять элементы многие
+// потоки: push_back, emplace_back и grow_by не берут блокировок. Каждый
+// поток забирает себе индексы одним fetch_add и конструирует элементы на
+// своих местах.
+//
+// Память - сегменты растущего размера, как в tbb::concurrent_vector:
+// сегмент 0 вмещает kFirstSegment элементов, сегмент k > 0 - kFirstSegment
+// * 2^(k-1), так что емкость удваивается без переноса элементов. Каталог
+// сегментов - массив фиксированной длины из атомарных указателей, он тоже
+// никогда не переезжает.
+//
+// Чтение элемента безопасно одновременно с добавлениями, если элемент уже
+// опубликован: поток, который его добавил, вернулся из push_back и передал
+// индекс (или итератор) читателю через любую синхронизацию. size()
+// считает и элементы, которые еще конструируются, поэтому читать все
+// [0, size()) можно только после того, как добавляющие потоки закончили.
+//
+// Остальные операции (копирование, присваивание, clear, reserve, swap)
+// с добавлениями одновременно вызывать нельзя. Аллокатор вызывается из
+// нескольких потоков и должен это допускать (std::allocator допускает).
+//
+// Если конструктор элемента бросил исключение, место уже занято индексом:
+// туда ставится T(), а исключение уходит вызывающему. Поэтому T должен
+// иметь конструктор по умолчанию без исключений. Нехватка памяти под
+// новый сегмент завершает программу (std::terminate).
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_vector {
+  static_assert(std::is_nothrow_default_constructible<T>::value,
+                "failed slots are filled with T()");
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  template <bool Const>
+  class ConcurrentIterator;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = ConcurrentIterator<false>;
+  using const_iterator = ConcurrentIterator<true>;
+  using size_type = size_t;
+
+  concurrent_vector() : concurrent_vector(Allocator()) {}
+
+  explicit concurrent_vector(const Allocator &alloc) : alloc_(alloc) {}
+
+  explicit concurrent_vector(size_type n, const Allocator &alloc = Allocator())
+      : concurrent_vector(alloc) {
+    grow_by(n);
+  }
+
+  concurrent_vector(std::initializer_list<value_type> const &items,
+                    const Allocator &alloc = Allocator())
+      : concurrent_vector(alloc) {
+    append_copy(items.begin(), items.end(), items.size());
+  }
+
+  concurrent_vector(const concurrent_vector &v)
+      : concurrent_vector(
+            alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    append_copy(v.begin(), v.end(), v.size());
+  }
+
+  concurrent_vector(concurrent_vector &&v) noexcept : alloc_(v.alloc_) {
+    take(v);
+  }
+
+  ~concurrent_vector() { release(); }
+
+  concurrent_vector &operator=(const concurrent_vector &v) {
+    if (this != &v) {
+      release();
+      alloc_on_copy(alloc_, v.alloc_);
+      append_copy(v.begin(), v.end(), v.size());
+    }
+    return *this;
+  }
+
+  concurrent_vector &operator=(concurrent_vector &&v) {
+    if (this != &v) {
+      release();
+      if (alloc_can_steal(alloc_, v.alloc_)) {
+        alloc_on_move(alloc_, v.alloc_);
+        take(v);
+      } else {
+        append_copy(std::make_move_iterator(v.begin()),
+                    std::make_move_iterator(v.end()), v.size());
+        v.release();
+      }
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("Position out of range");
+    }
+    return element(pos);
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Position out of range");
+    }
+    return element(pos);
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < size(), "concurrent_vector index out of range");
+    return element(pos);
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size(), "concurrent_vector index out of range");
+    return element(pos);
+  }
+  const_reference front() const {
+    if (empty()) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return element(0);
+  }
+  const_reference back() const {
+    if (empty()) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return element(size() - 1);
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size()); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+  size_type capacity() const noexcept {
+    size_type k = 0;
+    while (k < kMaxSegments &&
+           segments_[k].load(std::memory_order_acquire) != nullptr) {
+      k++;
+    }
+    return segment_base(k);
+  }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+  }
+
+  // Выделяет сегменты заранее, чтобы добавления не ждали аллокатора
+  void reserve(size_type new_capacity) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    for (size_type k = 0; segment_base(k) < new_capacity; k++) {
+      if (segments_[k].load(std::memory_order_relaxed) == nullptr) {
+        segments_[k].store(alloc_traits::allocate(alloc_, segment_size(k)),
+                           std::memory_order_release);
+      }
+    }
+  }
+
+  // Возвращают итератор на добавленный элемент
+  iterator push_back(const_reference value) { return emplace_back(value); }
+  iterator push_back(value_type &&value) {
+    return emplace_back(std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace_back(Args &&...args) {
+    size_type pos = size_.fetch_add(1, std::memory_order_acq_rel);
+    construct_range(pos, pos + 1, std::forward<Args>(args)...);
+    return iterator(this, pos);
+  }
+
+  // Добавляет n элементов T() одним куском индексов, возвращает итератор
+  // на первый из них
+  iterator grow_by(size_type n) {
+    size_type first = size_.fetch_add(n, std::memory_order_acq_rel);
+    construct_range(first, first + n);
+    return iterator(this, first);
+  }
+
+  iterator grow_by(size_type n, const_reference value) {
+    size_type first = size_.fetch_add(n, std::memory_order_acq_rel);
+    construct_range(first, first + n, value);
+    return iterator(this, first);
+  }
+
+  // Удаляет элементы, сегменты остаются
+  void clear() noexcept {
+    destroy_all();
+    size_.store(0, std::memory_order_release);
+  }
+
+  void swap(concurrent_vector &other) noexcept {
+    alloc_on_swap(alloc_, other.alloc_);
+    for (size_type k = 0; k < kMaxSegments; k++) {
+      T *mine = segments_[k].load(std::memory_order_relaxed);
+      segments_[k].store(other.segments_[k].load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+      other.segments_[k].store(mine, std::memory_order_relaxed);
+    }
+    size_type size = size_.load(std::memory_order_relaxed);
+    size_.store(other.size_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    other.size_.store(size, std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_type kFirstSegment = default_segment_size<T>();
+  static constexpr size_type kFirstShift = [] {
+    size_type shift = 0;
+    while ((size_type(1) << shift) < kFirstSegment) {
+      shift++;
+    }
+    return shift;
+  }();
+  // Сегментов хватает на весь size_t индексов
+  static constexpr size_type kMaxSegments =
+      std::numeric_limits<std::size_t>::digits - kFirstShift + 1;
+
+  std::atomic<T *> segments_[kMaxSegments] = {};
+  std::atomic<size_type> size_{0};
+  Allocator alloc_;
+
+  static size_type segment_of(size_type pos) noexcept {
+    if (pos < kFirstSegment) {
+      return 0;
+    }
+    size_type high_bit = std::numeric_limits<std::size_t>::digits - 1 -
+                         static_cast<size_type>(__builtin_clzll(pos));
+    return high_bit - kFirstShift + 1;
+  }
+
+  static size_type segment_base(size_type k) noexcept {
+    return k == 0 ? 0 : kFirstSegment << (k - 1);
+  }
+
+  static size_type segment_size(size_type k) noexcept {
+    return k == 0 ? kFirstSegment : kFirstSegment << (k - 1);
+  }
+
+  T &element(size_type pos) const noexcept {
+    size_type k = segment_of(pos);
+    return segments_[k].load(std::memory_order_acquire)[pos - segment_base(k)];
+  }
+
+  // Сегмент k, при необходимости выделенный этим потоком. Если сегмент
+  // нужен нескольким потокам сразу, каждый выделяет свой, ставит его
+  // compare_exchange, проигравшие отдают память обратно. Большие сегменты
+  // аллокатор берет через mmap без касания страниц, так что лишние
+  // выделения дешевы. Нехватка памяти завершает программу: индексы уже
+  // розданы, и вернуть их нельзя.
+  T *segment_for(size_type k) noexcept {
+    T *segment = segments_[k].load(std::memory_order_acquire);
+    if (segment != nullptr) {
+      return segment;
+    }
+    T *fresh = alloc_traits::allocate(alloc_, segment_size(k));
+    if (segments_[k].compare_exchange_strong(segment, fresh,
+                                             std::memory_order_acq_rel)) {
+      return fresh;
+    }
+    alloc_traits::deallocate(alloc_, fresh, segment_size(k));
+    return segment;
+  }
+
+  // Конструирует элементы [first, last) по сегментам
+  template <typename... Args>
+  void construct_range(size_type first, size_type last, Args &&...args) {
+    while (first < last) {
+      size_type k = segment_of(first);
+      size_type base = segment_base(k);
+      size_type stop = std::min(last, base + segment_size(k));
+      T *segment = segment_for(k);
+      for (size_type pos = first; pos < stop; pos++) {
+        try {
+          alloc_traits::construct(alloc_, segment + (pos - base),
+                                  std::forward<Args>(args)...);
+        } catch (...) {
+          fill_failed(pos, last);
+          throw;
+        }
+      }
+      first = stop;
+    }
+  }
+
+  // Индексы [first, last) уже отданы этому потоку, их нельзя вернуть:
+  // места заполняются T(), чтобы деструктор видел живые объекты
+  void fill_failed(size_type first, size_type last) noexcept {
+    while (first < last) {
+      size_type k = segment_of(first);
+      size_type base = segment_base(k);
+      size_type stop = std::min(last, base + segment_size(k));
+      T *segment = segment_for(k);
+      for (size_type pos = first; pos < stop; pos++) {
+        ::new (static_cast<void *>(segment + (pos - base))) T();
+      }
+      first = stop;
+    }
+  }
+
+  template <typename InputIt>
+  void append_copy(InputIt first, InputIt last, size_type count) {
+    reserve(size() + count);
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+
+  void destroy_all() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value ||
+                  !allocator_constructs_plainly<Allocator, T>::value) {
+      size_type n = size_.load(std::memory_order_relaxed);
+      for (size_type pos = 0; pos < n; pos++) {
+        alloc_traits::destroy(alloc_, &element(pos));
+      }
+    }
+  }
+
+  void release() noexcept {
+    destroy_all();
+    for (size_type k = 0; k < kMaxSegments; k++) {
+      T *segment = segments_[k].exchange(nullptr, std::memory_order_relaxed);
+      if (segment != nullptr) {
+        alloc_traits::deallocate(alloc_, segment, segment_size(k));
+      }
+    }
+    size_.store(0, std::memory_order_relaxed);
+  }
+
+  void take(concurrent_vector &v) noexcept {
+    for (size_type k = 0; k < kMaxSegments; k++) {
+      segments_[k].store(
+          v.segments_[k].exchange(nullptr, std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+    size_.store(v.size_.exchange(0, std::memory_order_relaxed),
+                std::memory_order_relaxed);
+  }
+
+  // Итератор произвольного доступа по индексу. Элементы не переезжают,
+  // поэтому итераторы остаются действительными при любых добавлениях.
+  template <bool Const>
+  class ConcurrentIterator {
+    using owner =
+        std::conditional_t<Const, const concurrent_vector, concurrent_vector>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    ConcurrentIterator() noexcept : vector_(nullptr), pos_(0) {}
+    ConcurrentIterator(owner *vector, size_type pos) noexcept
+        : vector_(vector), pos_(pos) {}
+    // iterator -> const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    ConcurrentIterator(const ConcurrentIterator<false> &other) noexcept
+        : vector_(other.vector_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept { return vector_->element(pos_); }
+    pointer operator->() const noexcept { return &**this; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    ConcurrentIterator &operator++() noexcept {
+      pos_++;
+      return *this;
+    }
+    ConcurrentIterator operator++(int) noexcept {
+      ConcurrentIterator tmp(*this);
+      pos_++;
+      return tmp;
+    }
+    ConcurrentIterator &operator--() noexcept {
+      pos_--;
+      return *this;
+    }
+    ConcurrentIterator operator--(int) noexcept {
+      ConcurrentIterator tmp(*this);
+      pos_--;
+      return tmp;
+    }
+    ConcurrentIterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    ConcurrentIterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    friend ConcurrentIterator operator+(ConcurrentIterator it,
+                                        difference_type n) noexcept {
+      return it += n;
+    }
+    friend ConcurrentIterator operator+(difference_type n,
+                                        ConcurrentIterator it) noexcept {
+      return it += n;
+    }
+    friend ConcurrentIterator operator-(ConcurrentIterator it,
+                                        difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const ConcurrentIterator &a,
+                                     const ConcurrentIterator &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+
+    bool operator==(const ConcurrentIterator &other) const noexcept {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const ConcurrentIterator &other) const noexcept {
+      return pos_ != other.pos_;
+    }
+    bool operator<(const ConcurrentIterator &other) const noexcept {
+      return pos_ < other.pos_;
+    }
+    bool operator>(const ConcurrentIterator &other) const noexcept {
+      return pos_ > other.pos_;
+    }
+    bool operator<=(const ConcurrentIterator &other) const noexcept {
+      return pos_ <= other.pos_;
+    }
+    bool operator>=(const ConcurrentIterator &other) const noexcept {
+      return pos_ >= other.pos_;
+    }
+
+   private:
+    friend class ConcurrentIterator<!Const>;
+
+    owner *vector_;
+    size_type pos_;
+  };
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CONCURRENT_VECTOR_H
@@ -0,0 +1,29 @@
+#ifndef CONTAINERS_HARDENING_H
+#define CONTAINERS_HARDENING_H
+
+#include <cstdio>
+#include <cstdlib>
+
+// operator[] контейнеров по умолчанию не проверяет индекс, как в
+// стандартной библиотеке: проверка стоит только в at(). Сборка с
+// -DS21_HARDENED возвращает проверки в operator[] в виде утверждений:
+// выход за границы печатает место ошибки и завершает программу.
+// В отличие от assert, утверждения не отключаются через NDEBUG.
+
+namespace s21 {
+[[noreturn]] inline void hardening_failure(const char *file, int line,
+                                           const char *message) noexcept {
+  std::fprintf(stderr, "%s:%d: s21 hardening check failed: %s\n", file, line,
+               message);
+  std::abort();
+}
+}  // namespace s21
+
+#ifdef S21_HARDENED
+#define S21_HARDENING_ASSERT(cond, message) \
+  ((cond) ? (void)0 : ::s21::hardening_failure(__FILE__, __LINE__, message))
+#else
+#define S21_HARDENING_ASSERT(cond, message) ((void)0)
+#endif
+
+#endif  // CONTAINERS_HARDENING_H
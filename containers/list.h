@@ -1,11 +1,16 @@
 #ifndef CONTAINERS_LIST_H
 #define CONTAINERS_LIST_H
 
-#include "../containers.h"
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "memory.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  private:
   struct Node;
@@ -14,25 +19,30 @@ class list {
 
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T&;
   using const_reference = const T&;
-  using iterator = list<value_type>::ListIterator;
-  using const_iterator = const list<value_type>::ListConstIterator;
+  using iterator = list::ListIterator;
+  using const_iterator = const list::ListConstIterator;
   using size_type = std::size_t;
 
   // дефолтный конструктор
-  list() : head_(nullptr), size_(0), tail_(nullptr) {}
+  list() : list(Allocator()) {}
+
+  explicit list(const Allocator& alloc)
+      : head_(nullptr), size_(0), tail_(nullptr), alloc_(alloc) {}
 
   // параметрический конструктор
-  explicit list(size_type n) : list() {
+  explicit list(size_type n, const Allocator& alloc = Allocator())
+      : list(alloc) {
     if (n == 0) {
       return;
     }
-    head_ = new Node;
+    head_ = create_node();
     tail_ = head_;
     Node* current_node = head_;
     for (size_t i = 1; i < n; i++) {
-      current_node->next = new Node;
+      current_node->next = create_node();
       current_node->next->prev = current_node;
       current_node = current_node->next;
       tail_ = current_node;
@@ -40,21 +50,31 @@ class list {
     size_ = n;
   }
 
-  list(std::initializer_list<value_type> const& items) : list() {
+  list(std::initializer_list<value_type> const& items,
+       const Allocator& alloc = Allocator())
+      : list(alloc) {
     for (auto item : items) {
       push_back(item);
     }
   }
 
   // copy constructor - NT
-  list(const list& l) : list() {
+  list(const list& l)
+      : list(allocator_type(
+            node_traits::select_on_container_copy_construction(l.alloc_))) {
+    for (auto item : l) {
+      push_back(item);
+    }
+  }
+
+  list(const list& l, const Allocator& alloc) : list(alloc) {
     for (auto item : l) {
       push_back(item);
     }
   }
 
   // move constructor - NT
-  list(list&& l) noexcept : list() {
+  list(list&& l) noexcept : list(l.get_allocator()) {
     std::swap(this->head_, l.head_);
     std::swap(this->tail_, l.tail_);
     this->size_ = l.size();
@@ -63,19 +83,32 @@ class list {
     l.size_ = 0;
   }
 
+  list(list&& l, const Allocator& alloc) : list(alloc) {
+    *this = std::move(l);
+  }
+
   // destructor
   ~list() { destructor_impl(head_); }
 
   // overload for moving - NT
-  list& operator=(list&& l) noexcept {
+  list& operator=(list&& l) {
     if (this != &l) {
       // Освобождаем ресурсы текущего объекта
       clear();
-      // Обмениваем указатели на голову и хвост
-      std::swap(this->head_, l.head_);
-      std::swap(this->tail_, l.tail_);
-      // Обмениваем размеры
-      std::swap(this->size_, l.size_);
+      if (alloc_can_steal(alloc_, l.alloc_)) {
+        alloc_on_move(alloc_, l.alloc_);
+        // Обмениваем указатели на голову и хвост
+        std::swap(this->head_, l.head_);
+        std::swap(this->tail_, l.tail_);
+        // Обмениваем размеры
+        std::swap(this->size_, l.size_);
+      } else {
+        // узлы l принадлежат чужому аллокатору, переносим значения
+        for (auto iter = l.begin(); iter != l.end(); ++iter) {
+          push_back(std::move(*iter));
+        }
+        l.clear();
+      }
     }
     return *this;
   }
@@ -84,6 +117,7 @@ class list {
     if (this != &l) {
       // Освобождаем ресурсы текущего объекта
       clear();
+      alloc_on_copy(alloc_, l.alloc_);
 
       // Копируем элементы из списка l
       for (auto iter = l.begin(); iter != l.end(); ++iter) {
@@ -111,52 +145,36 @@ class list {
 
   const_iterator cbegin() const noexcept { return const_iterator(head_); }
 
-  iterator end() const noexcept { return iterator(tail_->next); }
+  iterator end() const noexcept { return iterator(nullptr); }
 
   bool empty() const noexcept { return size_ == 0; }
 
   size_type size() const noexcept { return size_; }
 
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
   void clear() noexcept {
+    if constexpr (can_drop_without_release_v<node_allocator, value_type>) {
+      // память узлов вернется вместе со всей ареной
+      head_ = nullptr;
+    }
     while (head_ != nullptr) {
       Node* next_node = head_->next;
-      delete head_;
+      destroy_node(head_);
       head_ = next_node;
     }
+    tail_ = nullptr;
     size_ = 0;
   }
 
   iterator insert(iterator pos, const_reference value) {
-    Node* newNode = new Node(value);
-    if (!newNode) {
-      throw std::bad_alloc();
-    }
-    if (pos.getNode() == nullptr) {
-      if (empty()) {
-        head_ = newNode;
-        tail_ = newNode;
-        size_++;
-      } else {
-        Node* tmp = tail_;
-        tail_->next = newNode;
-        newNode->prev = tmp;
-        tail_ = newNode;
-        size_++;
-      }
-    } else {
-      Node* prevNode = pos.getNode()->prev;
-      if (prevNode) {
-        prevNode->next = newNode;
-        newNode->prev = prevNode;
-      }
-      newNode->next = pos.getNode();
-      pos.getNode()->prev = newNode;
-      if (pos.getNode() == head_) {
-        head_ = newNode;
-      }
-      size_++;
-    }
-    return iterator(newNode);
+    return link(pos, create_node(value));
+  }
+
+  iterator insert(iterator pos, value_type&& value) {
+    return link(pos, create_node(std::move(value)));
   }
 
   void erase(iterator pos) noexcept {
@@ -176,7 +194,7 @@ class list {
     } else {
       tail_ = prev_node;
     }
-    delete current_node;
+    destroy_node(current_node);
     size_--;
   }
 
@@ -188,10 +206,12 @@ class list {
     }
   }
 
+  void push_back(value_type&& value) { insert(end(), std::move(value)); }
+
   void pop_back() noexcept {
     if (!empty()) {
       if (size_ == 1) {
-        delete head_;
+        destroy_node(head_);
         head_ = nullptr;
         tail_ = nullptr;
       } else {
@@ -216,13 +236,14 @@ class list {
   }
 
   void swap(list& other) noexcept {
-    auto temp = std::move(other);
-    other = std::move(*this);
-    *this = std::move(temp);
+    alloc_on_swap(alloc_, other.alloc_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
   }
 
   void merge(list& other) {
-    list<value_type> mergedList;
+    list mergedList(get_allocator());
     iterator thisBegin = begin();
     iterator otherBegin = other.begin();
     while (thisBegin != end()) {
@@ -240,7 +261,7 @@ class list {
 
   void splice(const_iterator pos, list& other) noexcept {
     iterator tempIterator =
-        iterator(const_cast<s21::list<int>::Node*>(pos.getNode()));
+        iterator(const_cast<Node*>(pos.getNode()));
 
     for (auto it = other.begin(); it != other.end(); ++it) {
       insert(tempIterator, *it);
@@ -306,15 +327,71 @@ class list {
     // Constructor with a value parameter
     explicit Node(const_reference value)
         : value(value), next(nullptr), prev(nullptr) {}
+    explicit Node(value_type&& value)
+        : value(std::move(value)), next(nullptr), prev(nullptr) {}
   };
 
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  // Узлы создаются и удаляются только через аллокатор списка
+  template <typename... Args>
+  Node* create_node(Args&&... args) {
+    Node* node = node_traits::allocate(alloc_, 1);
+    try {
+      node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  // Вставляет готовый узел newNode перед pos
+  iterator link(iterator pos, Node* newNode) noexcept {
+    if (pos.getNode() == nullptr) {
+      if (empty()) {
+        head_ = newNode;
+        tail_ = newNode;
+        size_++;
+      } else {
+        Node* tmp = tail_;
+        tail_->next = newNode;
+        newNode->prev = tmp;
+        tail_ = newNode;
+        size_++;
+      }
+    } else {
+      Node* prevNode = pos.getNode()->prev;
+      if (prevNode) {
+        prevNode->next = newNode;
+        newNode->prev = prevNode;
+      }
+      newNode->next = pos.getNode();
+      pos.getNode()->prev = newNode;
+      if (pos.getNode() == head_) {
+        head_ = newNode;
+      }
+      size_++;
+    }
+    return iterator(newNode);
+  }
+
+  void destroy_node(Node* node) noexcept {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
   void destructor_impl(Node* node) {
+    if constexpr (can_drop_without_release_v<node_allocator, value_type>) {
+      return;
+    }
     while (node != nullptr) {
       Node* next_node = node->next;
-      delete node;
+      destroy_node(node);
       node = next_node;
     }
-    delete node;
   }
 
   class ListIterator {
@@ -420,6 +497,7 @@ class list {
   Node* head_ = nullptr;  // указатель на начало списка
   size_type size_ = 0;    // размер списка
   Node* tail_ = nullptr;  // указатель на конец списка
+  node_allocator alloc_;  // аллокатор узлов
 };
 }  // namespace s21
 #endif
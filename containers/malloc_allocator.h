@@ -0,0 +1,61 @@
+#ifndef CONTAINERS_MALLOC_ALLOCATOR_H
+#define CONTAINERS_MALLOC_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Аллокатор поверх malloc/free. Его главное отличие - reallocate(): вектор
+// тривиально переносимых элементов растет через realloc, который может
+// расширить блок на месте, а большие блоки glibc переносит через mremap без
+// копирования страниц.
+// Память из malloc не видна глобальному operator new, поэтому
+// alloc_tracker ее не считает.
+template <typename T>
+class malloc_allocator {
+ public:
+  using value_type = T;
+  using is_always_equal = std::true_type;
+
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "malloc does not guarantee this alignment");
+
+  malloc_allocator() noexcept = default;
+  template <typename U>
+  malloc_allocator(const malloc_allocator<U> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    void *p = std::malloc(n * sizeof(T));
+    if (p == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, std::size_t) noexcept { std::free(p); }
+
+  // Только для тривиально переносимых T: содержимое переносится побайтово
+  T *reallocate(T *p, std::size_t, std::size_t new_n) {
+    void *result = std::realloc(p, new_n * sizeof(T));
+    if (result == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(result);
+  }
+
+  template <typename U>
+  bool operator==(const malloc_allocator<U> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const malloc_allocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_MALLOC_ALLOCATOR_H
@@ -3,13 +3,15 @@
 
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <utility>
 
-#include "../containers.h"
+#include "RBT.h"
 
 namespace s21 {
 
-template <typename Key, typename T>
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
 class map {
  public:
   using key_type = Key;
@@ -17,26 +19,40 @@ class map {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename RBTree<key_type, mapped_type>::TreeIterator;
-  using const_iterator =
-      typename RBTree<key_type, mapped_type>::ConstTreeIterator;
+  using allocator_type = Allocator;
+  using tree_type = RBTree<key_type, mapped_type, Allocator>;
+  using iterator = typename tree_type::TreeIterator;
+  using const_iterator = typename tree_type::ConstTreeIterator;
   using size_type = std::size_t;
-  using TreeNode = typename s21::RBTree<key_type, mapped_type>::TreeNode;
+  using TreeNode = typename tree_type::TreeNode;
 
-  map() noexcept = default;
+  map() = default;
 
-  map(std::initializer_list<value_type> const& items) {
+  explicit map(const Allocator& alloc) : tree_(alloc) {}
+
+  map(std::initializer_list<value_type> const& items,
+      const Allocator& alloc = Allocator())
+      : tree_(alloc) {
     for (const auto& item : items) {
       insert(item);
     }
   }
   // copy constructor
   map(const map& other) : tree_(other.tree_) {}
+  map(const map& other, const Allocator& alloc) : tree_(other.tree_, alloc) {}
   // Move constructor
   map(map&& m) noexcept : tree_(std::move(m.tree_)) {}
+  map(map&& m, const Allocator& alloc) : tree_(std::move(m.tree_), alloc) {}
+
+  map& operator=(const map& m) {
+    if (this != &m) {
+      tree_ = m.tree_;
+    }
+    return *this;
+  }
   // Move assignment operator
 
-  map& operator=(map&& m) noexcept {
+  map& operator=(map&& m) {
     if (this != &m) {
       tree_ = std::move(m.tree_);
     }
@@ -48,9 +64,14 @@ class map {
 
   iterator end() noexcept { return tree_.end(); }
 
-  bool empty() noexcept { return tree_.empty(); }
+  const_iterator begin() const noexcept { return tree_.cbegin(); }
+  const_iterator end() const noexcept { return tree_.cend(); }
+  const_iterator cbegin() const noexcept { return tree_.cbegin(); }
+  const_iterator cend() const noexcept { return tree_.cend(); }
 
-  size_type size() noexcept { return tree_.size(); }
+  bool empty() const noexcept { return tree_.empty(); }
+
+  size_type size() const noexcept { return tree_.size(); }
 
   size_type max_size() noexcept {
     return std::numeric_limits<size_type>::max() / sizeof(value_type);
@@ -58,11 +79,15 @@ class map {
 
   void clear() noexcept { tree_.clear(); }
 
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
   iterator find(const Key& key) { return tree_.find(key); }
 
   std::pair<iterator, bool> insert(const value_type& value) {
     // Create a new TreeNode
-    TreeNode* newNode = new TreeNode(value.first, value.second);
+    TreeNode* newNode = tree_.createNode(value.first, value.second);
     // Call the insertNode function on the RBTree instance (tree_)
     return tree_.insertNode(newNode, tree_.root_);
   }
@@ -70,7 +95,7 @@ class map {
   std::pair<iterator, bool> insert(const Key& key, const T& obj) {
     // inserts value by key and returns iterator to where the element is in the
     // container and bool denoting whether the insertion took place
-    TreeNode* newNode = new TreeNode(key, obj);
+    TreeNode* newNode = tree_.createNode(key, obj);
     return tree_.insertNode(newNode, tree_.root_);
   }
 
@@ -82,11 +107,18 @@ class map {
       return std::make_pair(iterator(existingNode), false);
     } else {
       // If the key does not exist, insert a new node
-      TreeNode* newNode = new TreeNode(key, obj);
+      TreeNode* newNode = tree_.createNode(key, obj);
       return tree_.insertNode(newNode, tree_.root_);
     }
   }
 
+  // Заменяет содержимое n парами (ключ, значение) из next() за O(n).
+  // Ключи должны строго возрастать (так их пишет s21::serialize).
+  template <typename Source>
+  void assign_sorted(size_type n, Source next) {
+    tree_.buildSorted(n, next);
+  }
+
   void erase(iterator pos) { tree_.erase(pos); }
 
   void swap(map& other) {
@@ -113,7 +145,7 @@ class map {
   }
 
  private:
-  RBTree<key_type, mapped_type> tree_;
+  tree_type tree_;
 };
 
 }  // namespace s21
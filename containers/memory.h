@@ -0,0 +1,128 @@
+#ifndef CONTAINERS_MEMORY_H
+#define CONTAINERS_MEMORY_H
+
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Правила передачи аллокатора между контейнерами. Аллокатор переходит к
+// другому контейнеру только если его allocator_traits этого требуют:
+// например, std::pmr::polymorphic_allocator не копируется при присваивании
+// и не обменивается при swap, память остается у своего memory_resource.
+
+template <typename Alloc>
+void alloc_on_copy(Alloc &to, const Alloc &from) {
+  if constexpr (std::allocator_traits<
+                    Alloc>::propagate_on_container_copy_assignment::value) {
+    to = from;
+  }
+}
+
+template <typename Alloc>
+void alloc_on_move(Alloc &to, Alloc &from) {
+  if constexpr (std::allocator_traits<
+                    Alloc>::propagate_on_container_move_assignment::value) {
+    to = std::move(from);
+  }
+}
+
+template <typename Alloc>
+void alloc_on_swap(Alloc &a, Alloc &b) {
+  if constexpr (std::allocator_traits<
+                    Alloc>::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(a, b);
+  }
+}
+
+// true, если после move-присваивания контейнер может забрать память
+// источника целиком, а не переносить элементы по одному
+template <typename Alloc>
+bool alloc_can_steal(const Alloc &to, const Alloc &from) {
+  if constexpr (std::allocator_traits<
+                    Alloc>::propagate_on_container_move_assignment::value ||
+                std::allocator_traits<Alloc>::is_always_equal::value) {
+    return true;
+  } else {
+    return to == from;
+  }
+}
+
+// Аллокатор с вложенным типом releases_in_bulk = std::true_type освобождает
+// память только целиком (см. arena_allocator). Если к тому же элементы
+// тривиально разрушаемы, контейнеру незачем обходить узлы в деструкторе и
+// clear: достаточно забыть о них.
+template <typename Alloc, typename = void>
+struct allocator_releases_in_bulk : std::false_type {};
+
+template <typename Alloc>
+struct allocator_releases_in_bulk<Alloc,
+                                  std::void_t<typename Alloc::releases_in_bulk>>
+    : Alloc::releases_in_bulk {};
+
+template <typename Alloc, typename... Ts>
+inline constexpr bool can_drop_without_release_v =
+    allocator_releases_in_bulk<Alloc>::value &&
+    (std::is_trivially_destructible<Ts>::value && ...);
+
+// Объект T можно перенести побайтово: memcpy на новое место, а старое
+// забыть без деструктора. По умолчанию так можно с тривиально копируемыми
+// типами; свои типы без указателей на самих себя можно отметить
+// специализацией этого шаблона.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Аллокатор конструирует и разрушает T обычным placement new и деструктором,
+// то есть у него нет своих construct/destroy (или они ничего не добавляют,
+// как у polymorphic_allocator для типов без uses-allocator).
+template <typename Alloc, typename T, typename = void>
+struct allocator_has_construct : std::false_type {};
+
+template <typename Alloc, typename T>
+struct allocator_has_construct<
+    Alloc, T,
+    std::void_t<decltype(std::declval<Alloc &>().construct(
+        std::declval<T *>(), std::declval<T &&>()))>> : std::true_type {};
+
+template <typename Alloc, typename T, typename = void>
+struct allocator_has_destroy : std::false_type {};
+
+template <typename Alloc, typename T>
+struct allocator_has_destroy<
+    Alloc, T,
+    std::void_t<decltype(std::declval<Alloc &>().destroy(
+        std::declval<T *>()))>> : std::true_type {};
+
+template <typename Alloc, typename T>
+struct allocator_constructs_plainly
+    : std::bool_constant<!allocator_has_construct<Alloc, T>::value &&
+                         !allocator_has_destroy<Alloc, T>::value> {};
+
+template <typename U, typename T>
+struct allocator_constructs_plainly<std::pmr::polymorphic_allocator<U>, T>
+    : std::negation<std::uses_allocator<T, std::pmr::polymorphic_allocator<U>>> {
+};
+
+// Элементы можно переносить memcpy/memmove, минуя аллокатор
+template <typename Alloc, typename T>
+inline constexpr bool can_relocate_bytes_v =
+    is_trivially_relocatable<T>::value &&
+    allocator_constructs_plainly<Alloc, T>::value;
+
+// У аллокатора есть reallocate(p, old_n, new_n), которое может расширить
+// буфер на месте (см. malloc_allocator)
+template <typename Alloc, typename = void>
+struct allocator_can_reallocate : std::false_type {};
+
+template <typename Alloc>
+struct allocator_can_reallocate<
+    Alloc, std::void_t<decltype(std::declval<Alloc &>().reallocate(
+               std::declval<typename Alloc::value_type *>(), std::size_t(),
+               std::size_t()))>> : std::true_type {};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_MEMORY_H
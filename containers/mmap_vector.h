@@ -0,0 +1,523 @@
+#ifndef CONTAINERS_MMAP_VECTOR_H
+#define CONTAINERS_MMAP_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "vector.h"
+
+// Вектор, элементы которого лежат в отображенном в память файле. Открытие
+// существующего файла - это один mmap без чтения и копирования, поэтому
+// стоит O(1) при любом размере данных; страницы подгружаются ядром по мере
+// обращения.
+//
+// Формат файла: страница заголовка (kHeaderBytes байт) с сигнатурой,
+// версией, sizeof(T) и числом элементов, за ней элементы подряд. Емкость -
+// это все место в файле после заголовка: файл растет через ftruncate (без
+// записи на диск, новые страницы разреженные), отображение - через mremap.
+//
+// Размер в заголовке обновляется только в sync() и при закрытии, поэтому
+// после сбоя файл открывается в состоянии последней точки sync(): sync()
+// сначала сбрасывает на диск элементы и только потом новый размер.
+//
+// Режимы открытия (mmap_mode):
+//   read_write     - MAP_SHARED, изменения попадают в файл; файл создается,
+//                    если его нет
+//   read_only      - только чтение, любое изменение размера бросает
+//                    std::logic_error. Писать через неконстантные ссылки
+//                    нельзя: страницы защищены от записи
+//   copy_on_write  - MAP_PRIVATE: вектор можно менять как обычный, файл при
+//                    этом не меняется. Измененные страницы копируются ядром,
+//                    а при росте сверх файла элементы переезжают в анонимную
+//                    память
+//
+// T должен быть тривиально копируемым: элементы хранятся байтами файла.
+// Итераторы и ссылки, как у s21::vector, становятся недействительными при
+// росте емкости.
+//
+//   s21::mmap_vector<float> features("features.bin",
+//                                    s21::mmap_mode::read_only);
+//   float x = features[42];
+
+namespace s21 {
+
+enum class mmap_mode { read_write, read_only, copy_on_write };
+
+template <typename T>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_vector stores elements as raw file bytes");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  // Размер заголовка - часть формата файла и не зависит от размера
+  // страницы системы. Элементы начинаются с границы 4 КиБ, так что T может
+  // требовать выравнивание до kHeaderBytes.
+  static constexpr size_type kHeaderBytes = 4096;
+  static constexpr std::uint32_t kVersion = 1;
+
+  explicit mmap_vector(const std::string &path,
+                       mmap_mode mode = mmap_mode::read_write)
+      : mode_(mode) {
+    static_assert(alignof(T) <= kHeaderBytes, "element alignment too large");
+    open(path);
+  }
+
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector &operator=(const mmap_vector &) = delete;
+
+  mmap_vector(mmap_vector &&v) noexcept { swap(v); }
+
+  mmap_vector &operator=(mmap_vector &&v) noexcept {
+    if (this != &v) {
+      close();
+      swap(v);
+    }
+    return *this;
+  }
+
+  ~mmap_vector() { close(); }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return data_[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return data_[pos];
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "mmap_vector index out of range");
+    return data_[pos];
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "mmap_vector index out of range");
+    return data_[pos];
+  }
+  const_reference front() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return data_[0];
+  }
+  const_reference back() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return data_[size_ - 1];
+  }
+
+  iterator data() noexcept { return data_; }
+  const_iterator data() const noexcept { return data_; }
+
+  iterator begin() noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  mmap_mode mode() const noexcept { return mode_; }
+
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<std::size_t>::max() - kHeaderBytes) /
+           sizeof(value_type);
+  }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) {
+      remap(new_capacity);
+    }
+  }
+
+  // Возвращает лишнее место в файле. Для copy_on_write и read_only ничего
+  // не делает: файл им не принадлежит.
+  void shrink_to_fit() {
+    if (mode_ == mmap_mode::read_write && capacity_ > size_) {
+      remap(size_);
+    }
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      // args могут ссылаться на элементы, которые переедут при remap
+      T item(std::forward<Args>(args)...);
+      remap(recommend(size_ + 1));
+      return *::new (static_cast<void *>(data_ + size_++)) T(item);
+    }
+    return *::new (static_cast<void *>(data_ + size_++))
+        T(std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    check_writable();
+    if (size_ > 0) {
+      size_--;
+    }
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return insert(pos, 1, value);
+  }
+
+  iterator insert(iterator pos, size_type n, const_reference value) {
+    check_writable();
+    size_type offset = insert_offset(pos);
+    T item = value;
+    if (capacity_ - size_ < n) {
+      remap(recommend(size_ + n));
+    }
+    std::memmove(static_cast<void *>(data_ + offset + n), data_ + offset,
+                 (size_ - offset) * sizeof(T));
+    std::fill_n(data_ + offset, n, item);
+    size_ += n;
+    return data_ + offset;
+  }
+
+  iterator erase(iterator pos) { return erase(pos, pos + 1); }
+
+  iterator erase(iterator first, iterator last) {
+    check_writable();
+    if (first < begin() || first > last || last > end()) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    std::memmove(static_cast<void *>(first), last,
+                 (end() - last) * sizeof(T));
+    size_ -= last - first;
+    return first;
+  }
+
+  void clear() {
+    check_writable();
+    size_ = 0;
+  }
+
+  void resize(size_type n) { resize(n, T()); }
+
+  void resize(size_type n, const_reference value) {
+    check_writable();
+    if (n > size_) {
+      T item = value;
+      reserve(n);
+      std::fill(data_ + size_, data_ + n, item);
+    }
+    size_ = n;
+  }
+
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+
+  void swap(mmap_vector &other) noexcept {
+    std::swap(mode_, other.mode_);
+    std::swap(fd_, other.fd_);
+    std::swap(base_, other.base_);
+    std::swap(mapped_bytes_, other.mapped_bytes_);
+    std::swap(anonymous_, other.anonymous_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  // Точка сохранности: после возврата элементы и размер лежат на диске.
+  // Сначала сбрасываются элементы, затем заголовок, так что сбой посередине
+  // оставляет в файле размер предыдущей точки. В read_only и copy_on_write
+  // ничего не делает - эти режимы файл не меняют.
+  void sync() {
+    if (mode_ != mmap_mode::read_write) {
+      return;
+    }
+    // msync принимает только адрес на границе страницы. Заголовок занимает
+    // 4 КиБ в любой системе (это формат файла), а на страницах 16/64 КиБ
+    // элементы начинаются посреди первой страницы; тогда она сбрасывается
+    // целиком, со старым размером в заголовке.
+    size_type data_start = kHeaderBytes / page_size() * page_size();
+    if (::msync(base_ + data_start, mapped_bytes_ - data_start, MS_SYNC) !=
+        0) {
+      throw_errno("msync");
+    }
+    header()->size = size_;
+    if (::msync(base_, kHeaderBytes, MS_SYNC) != 0) {
+      throw_errno("msync");
+    }
+  }
+
+ private:
+  struct file_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t value_size;
+    std::uint64_t size;
+  };
+
+  static constexpr char kMagic[8] = {'s', '2', '1', 'm', 'v', 'e', 'c', '\0'};
+
+  mmap_mode mode_ = mmap_mode::read_only;
+  int fd_ = -1;
+  unsigned char *base_ = nullptr;
+  size_type mapped_bytes_ = 0;
+  // copy_on_write после переезда в анонимную память
+  bool anonymous_ = false;
+  T *data_ = nullptr;
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+
+  [[noreturn]] static void throw_errno(const std::string &what) {
+    throw std::system_error(errno, std::generic_category(),
+                            "mmap_vector: " + what);
+  }
+
+  file_header *header() noexcept {
+    return reinterpret_cast<file_header *>(base_);
+  }
+
+  static size_type page_size() noexcept {
+    static const size_type page =
+        static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+    return page;
+  }
+
+  static size_type page_round(size_type bytes) noexcept {
+    size_type page = page_size();
+    return (bytes + page - 1) / page * page;
+  }
+
+  void open(const std::string &path) {
+    int flags = mode_ == mmap_mode::read_write ? O_RDWR | O_CREAT : O_RDONLY;
+    fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+      throw_errno("open " + path);
+    }
+    try {
+      struct stat st;
+      if (::fstat(fd_, &st) != 0) {
+        throw_errno("fstat " + path);
+      }
+      size_type file_bytes = static_cast<size_type>(st.st_size);
+      bool fresh = file_bytes == 0 && mode_ == mmap_mode::read_write;
+      if (fresh) {
+        file_bytes = kHeaderBytes;
+        if (::ftruncate(fd_, static_cast<off_t>(file_bytes)) != 0) {
+          throw_errno("ftruncate " + path);
+        }
+      } else if (file_bytes < kHeaderBytes) {
+        throw std::runtime_error("mmap_vector: " + path +
+                                 " is not an mmap_vector file");
+      }
+      map(file_bytes);
+      if (fresh) {
+        std::memcpy(header()->magic, kMagic, sizeof(kMagic));
+        header()->version = kVersion;
+        header()->value_size = sizeof(T);
+        header()->size = 0;
+      }
+      check_header(path);
+    } catch (...) {
+      // заголовок мог оказаться чужим, его не трогаем
+      release();
+      throw;
+    }
+    if (mode_ != mmap_mode::read_write) {
+      // отображение держится и без дескриптора
+      ::close(fd_);
+      fd_ = -1;
+    }
+    if (mode_ == mmap_mode::read_only) {
+      // любой рост упрется в check_writable
+      capacity_ = size_;
+    }
+  }
+
+  void check_header(const std::string &path) {
+    const file_header *h = header();
+    if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0) {
+      throw std::runtime_error("mmap_vector: " + path +
+                               " is not an mmap_vector file");
+    }
+    if (h->version != kVersion || h->value_size != sizeof(T)) {
+      throw std::runtime_error("mmap_vector: " + path +
+                               " was written with another version or type");
+    }
+    if (h->size > capacity_) {
+      throw std::runtime_error("mmap_vector: " + path + " is truncated");
+    }
+    size_ = h->size;
+  }
+
+  void map(size_type bytes) {
+    int prot = mode_ == mmap_mode::read_only ? PROT_READ
+                                             : PROT_READ | PROT_WRITE;
+    int flags = mode_ == mmap_mode::copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+    void *p = ::mmap(nullptr, bytes, prot, flags, fd_, 0);
+    if (p == MAP_FAILED) {
+      throw_errno("mmap");
+    }
+    set_mapping(static_cast<unsigned char *>(p), bytes);
+  }
+
+  void set_mapping(unsigned char *base, size_type bytes) noexcept {
+    base_ = base;
+    mapped_bytes_ = bytes;
+    data_ = reinterpret_cast<T *>(base_ + kHeaderBytes);
+    capacity_ = (bytes - kHeaderBytes) / sizeof(T);
+  }
+
+  void close() noexcept {
+    if (base_ != nullptr) {
+      if (mode_ == mmap_mode::read_write) {
+        // размер уходит в файл вместе с остальными страницами при
+        // munmap, на диск его гарантированно сбрасывает только sync()
+        header()->size = size_;
+      }
+    }
+    release();
+  }
+
+  void release() noexcept {
+    if (base_ != nullptr) {
+      ::munmap(base_, mapped_bytes_);
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+    fd_ = -1;
+    base_ = nullptr;
+    mapped_bytes_ = 0;
+    anonymous_ = false;
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+  }
+
+  void check_writable() const {
+    if (mode_ == mmap_mode::read_only || base_ == nullptr) {
+      throw std::logic_error("mmap_vector: mapping is read-only");
+    }
+  }
+
+  size_type insert_offset(const_iterator pos) const {
+    if (pos < data_ || pos > data_ + size_) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    return static_cast<size_type>(pos - data_);
+  }
+
+  size_type recommend(size_type new_size) const {
+    if (new_size > max_size()) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    size_type grown = capacity_;
+    if (grown <= max_size() / S21_VECTOR_GROWTH_NUM) {
+      grown = grown * S21_VECTOR_GROWTH_NUM / S21_VECTOR_GROWTH_DEN;
+    } else {
+      grown = max_size();
+    }
+    return grown > new_size ? grown : new_size;
+  }
+
+  // Меняет емкость (вверх или вниз до size_). Файл read_write растет до
+  // отображения и укорачивается после него: за концом файла у отображения
+  // не должно быть страниц, к которым обращаются.
+  void remap(size_type new_capacity) {
+    check_writable();
+    size_type bytes = page_round(kHeaderBytes + new_capacity * sizeof(T));
+    if (bytes == mapped_bytes_) {
+      return;
+    }
+    if (mode_ == mmap_mode::read_write) {
+      bool grows = bytes > mapped_bytes_;
+      if (grows && ::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+        throw_errno("ftruncate");
+      }
+      remap_file(bytes);
+      if (!grows) {
+        // ошибка укорачивания оставляет лишь хвост за емкостью
+        (void)::ftruncate(fd_, static_cast<off_t>(bytes));
+      }
+    } else {
+      remap_private(bytes);
+    }
+  }
+
+  void remap_file(size_type bytes) {
+#ifdef MREMAP_MAYMOVE
+    void *p = ::mremap(base_, mapped_bytes_, bytes, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) {
+      throw_errno("mremap");
+    }
+    set_mapping(static_cast<unsigned char *>(p), bytes);
+#else
+    // без mremap отображение файла пересоздается, страницы остаются в кэше
+    // ядра и не копируются
+    ::munmap(base_, mapped_bytes_);
+    base_ = nullptr;
+    map(bytes);
+#endif
+  }
+
+  // copy_on_write: страницы за концом файла недоступны, поэтому при первом
+  // росте элементы переезжают в анонимную память, дальше она растет как
+  // обычный буфер
+  void remap_private(size_type bytes) {
+#ifdef MREMAP_MAYMOVE
+    if (anonymous_) {
+      void *p = ::mremap(base_, mapped_bytes_, bytes, MREMAP_MAYMOVE);
+      if (p == MAP_FAILED) {
+        throw_errno("mremap");
+      }
+      set_mapping(static_cast<unsigned char *>(p), bytes);
+      return;
+    }
+#endif
+    void *p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+      throw_errno("mmap");
+    }
+    std::memcpy(p, base_, kHeaderBytes + size_ * sizeof(T));
+    ::munmap(base_, mapped_bytes_);
+    anonymous_ = true;
+    set_mapping(static_cast<unsigned char *>(p), bytes);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_MMAP_VECTOR_H
@@ -0,0 +1,503 @@
+#ifndef CONTAINERS_PARALLEL_H
+#define CONTAINERS_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
+#include "vector.h"
+
+// Меньше стольких элементов алгоритмы s21::parallel работают
+// последовательно: запуск задач дороже выигрыша.
+#ifndef S21_PARALLEL_THRESHOLD
+#define S21_PARALLEL_THRESHOLD 32768
+#endif
+
+// Параллельные алгоритмы над непрерывными контейнерами s21 (vector, array):
+// sort, reduce, transform, for_each и inclusive_scan.
+//
+//   s21::vector<double> v = ...;
+//   s21::parallel::sort(v);
+//   double total = s21::parallel::reduce(v, 0.0);
+//
+// Работа режется на куски по размеру кэша L2 и раздается пулу потоков с
+// перехватом задач (work stealing). По умолчанию используется общий пул на
+// все ядра, свой пул можно передать последним аргументом.
+
+namespace s21 {
+namespace parallel {
+
+// Пул потоков с перехватом задач. У каждого потока своя очередь: новые
+// задачи он кладет в ее конец и берет оттуда же (данные еще в кэше), а
+// простаивающие потоки забирают задачи с начала чужих очередей. Поток,
+// который ждет свои задачи (task_group::wait), тоже выполняет задачи пула,
+// поэтому вложенные параллельные вызовы не блокируют друг друга.
+class thread_pool {
+ public:
+  // workers - число фоновых потоков; вызывающий поток работает вместе с ними
+  explicit thread_pool(std::size_t workers = default_workers()) {
+    for (std::size_t i = 0; i <= workers; i++) {
+      queues_.push_back(std::make_unique<task_queue>());
+    }
+    for (std::size_t i = 0; i < workers; i++) {
+      threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  // Сколько потоков одновременно выполняют задачи, считая вызывающий
+  std::size_t concurrency() const noexcept { return threads_.size() + 1; }
+
+  void submit(std::function<void()> task) {
+    task_queue &queue = *queues_[own_queue()];
+    // Счетчик растет раньше, чем задача станет видна: иначе поток, успевший
+    // ее забрать, уменьшил бы pending_ ниже нуля
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      pending_++;
+    }
+    try {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(std::move(task));
+    } catch (...) {
+      pending_--;
+      throw;
+    }
+    wake_.notify_one();
+  }
+
+  // Выполняет одну задачу: свою или перехваченную. false, если задач нет.
+  bool run_one() {
+    std::function<void()> task;
+    if (!take(task)) {
+      return false;
+    }
+    task();
+    return true;
+  }
+
+  // Общий пул на все ядра
+  static thread_pool &instance() {
+    static thread_pool pool;
+    return pool;
+  }
+
+  static std::size_t default_workers() noexcept {
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 0;
+  }
+
+ private:
+  struct task_queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  // Очередь текущего потока; потоки не из пула делят последнюю
+  std::size_t own_queue() const noexcept {
+    return current_pool_ == this ? current_index_ : queues_.size() - 1;
+  }
+
+  bool take(std::function<void()> &task) {
+    std::size_t own = own_queue();
+    for (std::size_t k = 0; k < queues_.size(); k++) {
+      task_queue &queue = *queues_[(own + k) % queues_.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) {
+        continue;
+      }
+      if (k == 0) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+      pending_--;
+      return true;
+    }
+    return false;
+  }
+
+  void worker_loop(std::size_t index) {
+    current_pool_ = this;
+    current_index_ = index;
+    while (true) {
+      if (run_one()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait(lock, [this] { return stop_ || pending_ > 0; });
+      if (stop_ && pending_ == 0) {
+        return;
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<task_queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::atomic<std::size_t> pending_{0};
+  bool stop_ = false;
+
+  inline static thread_local const thread_pool *current_pool_ = nullptr;
+  inline static thread_local std::size_t current_index_ = 0;
+};
+
+// Группа задач, которую можно дождаться. Первое исключение из задач
+// пробрасывается из wait().
+class task_group {
+ public:
+  explicit task_group(thread_pool &pool) : pool_(pool) {}
+
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+
+  // задачи ссылаются на данные вызывающего, поэтому ждем их и при исключении
+  ~task_group() {
+    while (pending_.load(std::memory_order_acquire) > 0) {
+      if (!pool_.run_one()) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  template <typename F>
+  void run(F task) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.submit([this, task]() mutable {
+      try {
+        task();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+      }
+      pending_.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  void wait() {
+    while (pending_.load(std::memory_order_acquire) > 0) {
+      if (!pool_.run_one()) {
+        std::this_thread::yield();
+      }
+    }
+    if (error_) {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  thread_pool &pool_;
+  std::atomic<std::size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+namespace detail {
+
+inline std::size_t cache_bytes() noexcept {
+  static const std::size_t bytes = [] {
+    long l2 = -1;
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+    return l2 > 0 ? static_cast<std::size_t>(l2) : std::size_t(256 * 1024);
+  }();
+  return bytes;
+}
+
+inline bool run_sequential(std::size_t n, const thread_pool &pool) noexcept {
+  return n < S21_PARALLEL_THRESHOLD || pool.concurrency() == 1;
+}
+
+// Сколько элементов отдавать одной задаче: кусок помещается в L2, а
+// кусков хватает на все потоки
+template <typename T>
+std::size_t chunk_size(std::size_t n, const thread_pool &pool) noexcept {
+  std::size_t by_cache = std::max<std::size_t>(1, cache_bytes() / sizeof(T));
+  std::size_t by_threads = (n + pool.concurrency() - 1) / pool.concurrency();
+  return std::max<std::size_t>(1, std::min(by_cache, by_threads));
+}
+
+// Вызывает body(first, last) для кусков [0, n) и ждет все
+template <typename Body>
+void for_chunks(thread_pool &pool, std::size_t n, std::size_t chunk,
+                const Body &body) {
+  task_group group(pool);
+  for (std::size_t first = 0; first < n; first += chunk) {
+    std::size_t last = std::min(n, first + chunk);
+    group.run([&body, first, last] { body(first, last); });
+  }
+  group.wait();
+}
+
+template <typename In, typename Out>
+void check_same_size(const In &in, const Out &out) {
+  if (in.size() != out.size()) {
+    throw std::invalid_argument("parallel: sizes differ");
+  }
+}
+
+// Сколько элементов a попадает в первые pos элементов устойчивого слияния
+// a и b (при равенстве первыми идут элементы a)
+template <typename T, typename Compare>
+std::size_t merge_split(const T *a, std::size_t na, const T *b, std::size_t nb,
+                        std::size_t pos, Compare &comp) {
+  std::size_t lo = pos > nb ? pos - nb : 0;
+  std::size_t hi = std::min(pos, na);
+  while (lo < hi) {
+    std::size_t i = lo + (hi - lo) / 2;
+    if (!comp(b[pos - i - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+// Сливает [lo, mid) и [mid, hi) из src в dst по кускам размера chunk.
+// Границы кусков считаются до запуска задач: задачи перемещают элементы
+// из src, и читать их после этого нельзя.
+template <typename T, typename Compare>
+void merge_runs(task_group &group, T *src, T *dst, std::size_t lo,
+                std::size_t mid, std::size_t hi, std::size_t chunk,
+                Compare &comp) {
+  const T *a = src + lo;
+  const T *b = src + mid;
+  std::size_t na = mid - lo;
+  std::size_t nb = hi - mid;
+  std::size_t a_first = 0;
+  for (std::size_t first = lo; first < hi; first += chunk) {
+    std::size_t last = std::min(hi, first + chunk);
+    std::size_t a_last = merge_split(a, na, b, nb, last - lo, comp);
+    std::size_t b_first = first - lo - a_first;
+    std::size_t b_last = last - lo - a_last;
+    group.run([=, &comp] {
+      std::merge(std::make_move_iterator(src + lo + a_first),
+                 std::make_move_iterator(src + lo + a_last),
+                 std::make_move_iterator(src + mid + b_first),
+                 std::make_move_iterator(src + mid + b_last), dst + first,
+                 comp);
+    });
+    a_first = a_last;
+  }
+}
+
+}  // namespace detail
+
+// f(element) для каждого элемента
+template <typename Container, typename F>
+void for_each(Container &&c, F f,
+              thread_pool &pool = thread_pool::instance()) {
+  using T = typename std::remove_reference_t<Container>::value_type;
+  auto *data = c.data();
+  std::size_t n = c.size();
+  if (detail::run_sequential(n, pool)) {
+    for (std::size_t i = 0; i < n; i++) {
+      f(data[i]);
+    }
+    return;
+  }
+  detail::for_chunks(pool, n, detail::chunk_size<T>(n, pool),
+                     [data, &f](std::size_t first, std::size_t last) {
+                       for (std::size_t i = first; i < last; i++) {
+                         f(data[i]);
+                       }
+                     });
+}
+
+// out[i] = op(in[i]); in и out могут быть одним контейнером
+template <typename In, typename Out, typename Op>
+void transform(const In &in, Out &&out, Op op,
+               thread_pool &pool = thread_pool::instance()) {
+  detail::check_same_size(in, out);
+  using T = typename In::value_type;
+  const auto *src = in.data();
+  auto *dst = out.data();
+  std::size_t n = in.size();
+  if (detail::run_sequential(n, pool)) {
+    for (std::size_t i = 0; i < n; i++) {
+      dst[i] = op(src[i]);
+    }
+    return;
+  }
+  detail::for_chunks(pool, n, detail::chunk_size<T>(n, pool),
+                     [src, dst, &op](std::size_t first, std::size_t last) {
+                       for (std::size_t i = first; i < last; i++) {
+                         dst[i] = op(src[i]);
+                       }
+                     });
+}
+
+// Свертка с init. op должна быть ассоциативной: куски сворачиваются
+// независимо, затем их итоги сворачиваются по порядку.
+template <typename Container, typename T, typename BinaryOp = std::plus<>>
+T reduce(const Container &c, T init, BinaryOp op = BinaryOp(),
+         thread_pool &pool = thread_pool::instance()) {
+  using Elem = typename Container::value_type;
+  const auto *data = c.data();
+  std::size_t n = c.size();
+  if (detail::run_sequential(n, pool)) {
+    for (std::size_t i = 0; i < n; i++) {
+      init = op(std::move(init), data[i]);
+    }
+    return init;
+  }
+  std::size_t chunk = detail::chunk_size<Elem>(n, pool);
+  std::vector<std::optional<T>> partials((n + chunk - 1) / chunk);
+  detail::for_chunks(pool, n, chunk,
+                     [&](std::size_t first, std::size_t last) {
+                       T partial = data[first];
+                       for (std::size_t i = first + 1; i < last; i++) {
+                         partial = op(std::move(partial), data[i]);
+                       }
+                       partials[first / chunk].emplace(std::move(partial));
+                     });
+  for (std::optional<T> &partial : partials) {
+    init = op(std::move(init), std::move(*partial));
+  }
+  return init;
+}
+
+// out[i] = in[0] op in[1] op ... op in[i]; op должна быть ассоциативной.
+// Два прохода: каждый кусок сканируется отдельно, затем к нему добавляется
+// итог всех предыдущих кусков.
+template <typename In, typename Out, typename BinaryOp = std::plus<>>
+void inclusive_scan(const In &in, Out &&out, BinaryOp op = BinaryOp(),
+                    thread_pool &pool = thread_pool::instance()) {
+  detail::check_same_size(in, out);
+  using T = typename std::remove_reference_t<Out>::value_type;
+  const auto *src = in.data();
+  auto *dst = out.data();
+  std::size_t n = in.size();
+  auto scan = [src, dst, &op](std::size_t first, std::size_t last) {
+    if (first < last) {
+      dst[first] = src[first];
+      for (std::size_t i = first + 1; i < last; i++) {
+        dst[i] = op(dst[i - 1], src[i]);
+      }
+    }
+  };
+  if (detail::run_sequential(n, pool)) {
+    scan(0, n);
+    return;
+  }
+  std::size_t chunk = detail::chunk_size<T>(n, pool);
+  detail::for_chunks(pool, n, chunk, scan);
+
+  s21::vector<T> offsets;
+  offsets.reserve(n / chunk + 1);
+  offsets.push_back(dst[chunk - 1]);
+  for (std::size_t first = chunk; first + chunk < n; first += chunk) {
+    offsets.push_back(op(offsets.back(), dst[first + chunk - 1]));
+  }
+  detail::for_chunks(pool, n - chunk, chunk,
+                     [&offsets, dst, chunk, &op](std::size_t first,
+                                                 std::size_t last) {
+                       const T &offset = offsets[first / chunk];
+                       for (std::size_t i = first; i < last; i++) {
+                         dst[chunk + i] = op(offset, dst[chunk + i]);
+                       }
+                     });
+}
+
+// Сортировка слиянием: куски сортируются std::sort параллельно, затем
+// сливаются попарно. Каждое слияние тоже делится на куски по позициям в
+// результате, так что все раунды загружают все потоки. Не устойчивая.
+template <typename Container, typename Compare = std::less<>>
+void sort(Container &&c, Compare comp = Compare(),
+          thread_pool &pool = thread_pool::instance()) {
+  using T = typename std::remove_reference_t<Container>::value_type;
+  T *data = c.data();
+  std::size_t n = c.size();
+  if constexpr (!std::is_default_constructible<T>::value) {
+    // буферу слияния нужны пустые элементы
+    std::sort(data, data + n, comp);
+    return;
+  } else {
+    if (detail::run_sequential(n, pool)) {
+      std::sort(data, data + n, comp);
+      return;
+    }
+    std::size_t runs = std::min(pool.concurrency() * 2,
+                                n / (S21_PARALLEL_THRESHOLD / 2));
+    s21::vector<std::size_t> bounds;
+    for (std::size_t r = 0; r <= runs; r++) {
+      bounds.push_back(n / runs * r + std::min(r, n % runs));
+    }
+    detail::for_chunks(pool, runs, 1,
+                       [&](std::size_t first, std::size_t) {
+                         std::sort(data + bounds[first],
+                                   data + bounds[first + 1], comp);
+                       });
+
+    s21::vector<T> buffer(n);
+    T *src = data;
+    T *dst = buffer.data();
+    std::size_t chunk = detail::chunk_size<T>(n, pool);
+    while (bounds.size() > 2) {
+      s21::vector<std::size_t> merged;
+      task_group group(pool);
+      std::size_t count = bounds.size() - 1;
+      for (std::size_t r = 0; r < count; r += 2) {
+        std::size_t lo = bounds[r];
+        std::size_t mid = bounds[r + 1];
+        std::size_t hi = r + 1 < count ? bounds[r + 2] : mid;
+        merged.push_back(lo);
+        detail::merge_runs(group, src, dst, lo, mid, hi, chunk, comp);
+      }
+      merged.push_back(n);
+      group.wait();
+      bounds = std::move(merged);
+      std::swap(src, dst);
+    }
+    if (src != data) {
+      detail::for_chunks(pool, n, chunk,
+                         [src, data](std::size_t first, std::size_t last) {
+                           std::move(src + first, src + last, data + first);
+                         });
+    }
+  }
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // CONTAINERS_PARALLEL_H
@@ -0,0 +1,52 @@
+#ifndef CONTAINERS_PMR_H
+#define CONTAINERS_PMR_H
+
+#include <memory_resource>
+
+#include "RBT.h"
+#include "list.h"
+#include "map.h"
+#include "queue.h"
+#include "set.h"
+#include "soa_vector.h"
+#include "stack.h"
+#include "vector.h"
+
+// Контейнеры, память которых берется из std::pmr::memory_resource, выбранного
+// во время выполнения:
+//   std::pmr::monotonic_buffer_resource arena;
+//   s21::pmr::map<int, int> scratch(&arena);
+// polymorphic_allocator не передается при копировании, присваивании и swap:
+// копия берет ресурс по умолчанию, а присваивание между контейнерами с
+// разными ресурсами переносит элементы, а не память.
+namespace s21 {
+namespace pmr {
+
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename Key, typename T>
+using map =
+    s21::map<Key, T,
+             std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+template <typename Key>
+using set = s21::set<Key, std::pmr::polymorphic_allocator<Key>>;
+
+template <typename T>
+using stack = s21::stack<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename T>
+using queue = s21::queue<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename... Ts>
+using soa_vector =
+    s21::basic_soa_vector<std::pmr::polymorphic_allocator<std::byte>, Ts...>;
+
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // CONTAINERS_PMR_H
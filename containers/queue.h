@@ -1,66 +1,147 @@
 #ifndef CONTAINERS_QUEUE_H
 #define CONTAINERS_QUEUE_H
 
-#include "../containers.h"
-#include "stack.h"
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "memory.h"
 
 namespace s21 {
-template <typename T>
+// Очередь на кольцевом буфере: элементы лежат в ячейках head_, head_ + 1,
+// ... по модулю емкости, push пишет за последним, pop сдвигает head_.
+// Ни push, ни pop не двигают остальные элементы, оба стоят O(1), а push -
+// амортизированно O(1): полный буфер удваивается, и элементы переезжают в
+// новый один раз, разворачиваясь в начало.
+//
+// Емкость - степень двойки, поэтому номер ячейки считается маской, а не
+// делением. По той же причине рост всегда вдвое, множитель
+// S21_VECTOR_GROWTH_NUM / S21_VECTOR_GROWTH_DEN здесь не действует.
+template <typename T, typename Allocator = std::allocator<T>>
 class queue {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
   // default
-  queue() : data_(nullptr), size_(0) {}
-  queue(std::initializer_list<value_type> const &items) : queue() {
-    size_ = items.size();
-    data_ = new value_type[size_];
-    std::copy(items.begin(), items.end(), data_);
+  queue() : queue(Allocator()) {}
+  explicit queue(const Allocator &alloc)
+      : data_(nullptr), head_(0), size_(0), capacity_(0), alloc_(alloc) {}
+  queue(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator())
+      : queue(alloc) {
+    reserve(items.size());
+    for (const_reference item : items) {
+      push(item);
+    }
   }
 
   // copy
-  queue(const queue &q) : queue() {
-    size_ = q.size_;
-    data_ = new value_type[size_];
-    for (size_type i = 0; i < size_; i++) {
-      data_[i] = q.data_[i];
-    }
+  queue(const queue &q)
+      : queue(alloc_traits::select_on_container_copy_construction(q.alloc_)) {
+    append_copy(q);
+  }
+  queue(const queue &q, const Allocator &alloc) : queue(alloc) {
+    append_copy(q);
   }
   // move
-  queue(queue &&q) : queue() { *this = std::move(q); }
-  ~queue() {
-    delete[] data_;
-    size_ = 0;
-    data_ = nullptr;
+  queue(queue &&q) noexcept
+      : data_(q.data_),
+        head_(q.head_),
+        size_(q.size_),
+        capacity_(q.capacity_),
+        alloc_(q.alloc_) {
+    q.forget();
+  }
+  queue(queue &&q, const Allocator &alloc) : queue(alloc) {
+    *this = std::move(q);
   }
+  ~queue() { release(); }
 
   queue &operator=(queue &&q) {
-    if (this != q) {
-      delete[] data_;
-      size_ = q.size_;
-      data_ = q.data_;
-      q.size_ = 0;
-      q.data_ = nullptr;
+    if (this != &q) {
+      if (alloc_can_steal(alloc_, q.alloc_)) {
+        release();
+        alloc_on_move(alloc_, q.alloc_);
+        data_ = q.data_;
+        head_ = q.head_;
+        size_ = q.size_;
+        capacity_ = q.capacity_;
+        q.forget();
+      } else {
+        // память q принадлежит чужому аллокатору, переносим элементы
+        clear();
+        reserve(q.size_);
+        for (size_type i = 0; i < q.size_; i++) {
+          push(std::move(q.slot(i)));
+        }
+        q.clear();
+      }
     }
+    return *this;
+  }
+
+  queue &operator=(const queue &q) {
+    if (this != &q) {
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (alloc_ != q.alloc_) {
+          release();
+        }
+      }
+      clear();
+      alloc_on_copy(alloc_, q.alloc_);
+      append_copy(q);
+    }
+    return *this;
+  }
+
+  reference front() {
+    if (!size_) {
+      throw std::out_of_range("Queue is empty");
+    }
+    return slot(0);
   }
   const_reference front() const {
     if (!size_) {
       throw std::out_of_range("Queue is empty");
     }
-    return data_[0];
+    return slot(0);
+  }
+  reference back() {
+    if (!size_) {
+      throw std::out_of_range("Queue is empty");
+    }
+    return slot(size_ - 1);
   }
   const_reference back() const {
     if (!size_) {
       throw std::out_of_range("Queue is empty");
     }
-    return data_[size_ - 1];
-
-    // return data_.back();
+    return slot(size_ - 1);
   }
   bool empty() const noexcept { return size_ == 0; }
-  size_type size() noexcept { return size_; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept {
+    return alloc_traits::max_size(alloc_);
+  }
+
+  // Готовит место под n элементов, емкость округляется до степени двойки
+  void reserve(size_type n) {
+    if (n > capacity_) {
+      relocate(grown_capacity(n));
+    }
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
   void print() const {
     if (empty()) {
       std::cout << "Queue is empty." << std::endl;
@@ -68,38 +149,195 @@ class queue {
     }
 
     for (size_type i = 0; i < size_; ++i) {
-      std::cout << data_[i] << " ";
+      std::cout << slot(i) << " ";
     }
 
     std::cout << std::endl;
   }
 
-  void push(const_reference value) {
-    value_type *tempQueue = data_;
-    data_ = new value_type[size_ + 1];
-    std::copy(tempQueue, tempQueue + size_, data_);
-    delete[] tempQueue;
-    data_[size_] = value;
-    size_++;
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    if (size_ == capacity_) {
+      grow_and_append(std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(alloc_, &slot(size_),
+                              std::forward<Args>(args)...);
+      size_++;
+    }
+    return slot(size_ - 1);
   }
 
   void pop() {
     if (size_ > 0) {
-      for (size_type i = 0; i < size_ - 1; i++) {
-        data_[i] = std::move(data_[i + 1]);
-      }
+      alloc_traits::destroy(alloc_, data_ + head_);
       size_--;
+      // пустая очередь снова пишет с начала буфера
+      head_ = size_ ? (head_ + 1) & (capacity_ - 1) : 0;
     }
   }
 
-  void swap(queue &other) {
-    std::swap(size_, other.size_);
+  void swap(queue &other) noexcept {
+    alloc_on_swap(alloc_, other.alloc_);
     std::swap(data_, other.data_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
   }
 
  private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  // Элементы переносятся в новый буфер memcpy, без конструктора
+  // перемещения и деструктора старой копии
+  static constexpr bool kRelocateBytes = can_relocate_bytes_v<Allocator, T>;
+  static constexpr size_type kMinCapacity = 8;
+
+  // i-й элемент от начала очереди
+  T &slot(size_type i) const noexcept {
+    return data_[(head_ + i) & (capacity_ - 1)];
+  }
+
+  // Наименьшая степень двойки не меньше n (и не меньше удвоенной емкости)
+  size_type grown_capacity(size_type n) const {
+    if (n > max_size()) {
+      throw std::length_error("queue size exceeds max_size");
+    }
+    size_type grown = capacity_ ? capacity_ : kMinCapacity;
+    while (grown < n) {
+      if (grown > max_size() / 2) {
+        throw std::length_error("queue size exceeds max_size");
+      }
+      grown *= 2;
+    }
+    return grown;
+  }
+
+  // Переносит элементы в начало dest по порядку очереди. Если перемещение
+  // может бросить, элементы копируются (move_if_noexcept), и при
+  // исключении очередь остается целой.
+  void move_into(T *dest) {
+    size_type first_part = std::min(size_, capacity_ - head_);
+    if constexpr (kRelocateBytes) {
+      if (size_ > 0) {
+        std::memcpy(static_cast<void *>(dest),
+                    static_cast<void *>(data_ + head_),
+                    first_part * sizeof(T));
+        std::memcpy(static_cast<void *>(dest + first_part),
+                    static_cast<void *>(data_),
+                    (size_ - first_part) * sizeof(T));
+      }
+    } else {
+      size_type constructed = 0;
+      try {
+        for (; constructed < size_; constructed++) {
+          alloc_traits::construct(alloc_, dest + constructed,
+                                  std::move_if_noexcept(slot(constructed)));
+        }
+      } catch (...) {
+        for (size_type i = 0; i < constructed; i++) {
+          alloc_traits::destroy(alloc_, dest + i);
+        }
+        throw;
+      }
+    }
+  }
+
+  // Заменяет буфер на new_data (элементы уже перенесены в его начало)
+  void adopt(T *new_data, size_type new_capacity) noexcept {
+    if constexpr (!kRelocateBytes) {
+      destroy_elements();
+    }
+    if (data_ != nullptr) {
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+    }
+    data_ = new_data;
+    head_ = 0;
+    capacity_ = new_capacity;
+  }
+
+  void relocate(size_type new_capacity) {
+    T *new_data = alloc_traits::allocate(alloc_, new_capacity);
+    try {
+      move_into(new_data);
+    } catch (...) {
+      alloc_traits::deallocate(alloc_, new_data, new_capacity);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+  }
+
+  // Добавление в полную очередь: новый элемент создается в новом буфере
+  // раньше переноса старых, поэтому args могут ссылаться на элементы самой
+  // очереди (q.push(q.front())).
+  template <typename... Args>
+  void grow_and_append(Args &&...args) {
+    size_type new_capacity = grown_capacity(size_ + 1);
+    T *new_data = alloc_traits::allocate(alloc_, new_capacity);
+    try {
+      alloc_traits::construct(alloc_, new_data + size_,
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      alloc_traits::deallocate(alloc_, new_data, new_capacity);
+      throw;
+    }
+    try {
+      move_into(new_data);
+    } catch (...) {
+      alloc_traits::destroy(alloc_, new_data + size_);
+      alloc_traits::deallocate(alloc_, new_data, new_capacity);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+    size_++;
+  }
+
+  void append_copy(const queue &q) {
+    reserve(size_ + q.size_);
+    for (size_type i = 0; i < q.size_; i++) {
+      push(q.slot(i));
+    }
+  }
+
+  void destroy_elements() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value ||
+                  !allocator_constructs_plainly<Allocator, T>::value) {
+      for (size_type i = 0; i < size_; i++) {
+        alloc_traits::destroy(alloc_, &slot(i));
+      }
+    }
+  }
+
+  // Удаляет элементы, буфер остается
+  void clear() noexcept {
+    destroy_elements();
+    head_ = 0;
+    size_ = 0;
+  }
+
+  void release() noexcept {
+    clear();
+    if (data_ != nullptr) {
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+    }
+    forget();
+  }
+
+  // Отдает буфер (после переноса в другую очередь)
+  void forget() noexcept {
+    data_ = nullptr;
+    head_ = 0;
+    size_ = 0;
+    capacity_ = 0;
+  }
+
   T *data_;
+  size_type head_;      // ячейка первого элемента
   size_type size_;
+  size_type capacity_;  // 0 или степень двойки
+  Allocator alloc_;
 };
 }  // namespace s21
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,407 @@
+#ifndef CONTAINERS_SEGMENTED_VECTOR_H
+#define CONTAINERS_SEGMENTED_VECTOR_H
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "memory.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Число элементов в сегменте по умолчанию: степень двойки, около 16 КиБ
+template <typename T>
+constexpr std::size_t default_segment_size() {
+  std::size_t n = 1;
+  while (n * 2 * sizeof(T) <= 16384) {
+    n *= 2;
+  }
+  return n;
+}
+
+// Вектор из сегментов по SegmentSize элементов. Когда место кончается,
+// добавляется новый сегмент, а старые элементы остаются на месте: рост не
+// копирует данные, поэтому push_back стоит O(1) без редких задержек на
+// перенос всего вектора, а указатели и ссылки на элементы живут до их
+// удаления.
+//
+// Доступ по индексу - через каталог сегментов: i >> shift выбирает
+// сегмент, i & mask - место в нем, поэтому SegmentSize - степень двойки.
+// Каталог - это s21::vector указателей, при росте он переносит только их.
+//
+// Элементы лежат непрерывно только внутри сегмента, поэтому data() нет, а
+// вставка и удаление - только в конце.
+template <typename T, std::size_t SegmentSize = default_segment_size<T>(),
+          typename Allocator = std::allocator<T>>
+class segmented_vector {
+  static_assert(SegmentSize > 0 && (SegmentSize & (SegmentSize - 1)) == 0,
+                "segment size must be a power of 2");
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using directory_allocator =
+      typename alloc_traits::template rebind_alloc<T *>;
+
+  template <bool Const>
+  class SegmentIterator;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = SegmentIterator<false>;
+  using const_iterator = SegmentIterator<true>;
+  using size_type = size_t;
+
+  static constexpr size_type segment_size = SegmentSize;
+
+  segmented_vector() : segmented_vector(Allocator()) {}
+
+  explicit segmented_vector(const Allocator &alloc)
+      : segments_(directory_allocator(alloc)), size_(0), alloc_(alloc) {}
+
+  explicit segmented_vector(size_type n, const Allocator &alloc = Allocator())
+      : segmented_vector(alloc) {
+    resize(n);
+  }
+
+  segmented_vector(std::initializer_list<value_type> const &items,
+                   const Allocator &alloc = Allocator())
+      : segmented_vector(alloc) {
+    append_copy(items.begin(), items.end(), items.size());
+  }
+
+  segmented_vector(const segmented_vector &v)
+      : segmented_vector(
+            alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    append_copy(v.begin(), v.end(), v.size_);
+  }
+
+  segmented_vector(segmented_vector &&v) noexcept
+      : segments_(std::move(v.segments_)), size_(v.size_), alloc_(v.alloc_) {
+    v.size_ = 0;
+  }
+
+  ~segmented_vector() { release(); }
+
+  segmented_vector &operator=(const segmented_vector &v) {
+    if (this != &v) {
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (alloc_ != v.alloc_) {
+          release();
+        }
+      }
+      clear();
+      alloc_on_copy(alloc_, v.alloc_);
+      append_copy(v.begin(), v.end(), v.size_);
+    }
+    return *this;
+  }
+
+  segmented_vector &operator=(segmented_vector &&v) {
+    if (this != &v) {
+      if (alloc_can_steal(alloc_, v.alloc_)) {
+        release();
+        alloc_on_move(alloc_, v.alloc_);
+        segments_ = std::move(v.segments_);
+        size_ = v.size_;
+        v.size_ = 0;
+      } else {
+        // сегменты v принадлежат чужому аллокатору, переносим элементы
+        clear();
+        append_copy(std::make_move_iterator(v.begin()),
+                    std::make_move_iterator(v.end()), v.size_);
+        v.clear();
+      }
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return element(pos);
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return element(pos);
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "segmented_vector index out of range");
+    return element(pos);
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "segmented_vector index out of range");
+    return element(pos);
+  }
+  const_reference front() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return element(0);
+  }
+  const_reference back() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return element(size_ - 1);
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  iterator begin() noexcept { return iterator(segments_.data(), 0); }
+  iterator end() noexcept { return iterator(segments_.data(), size_); }
+  const_iterator begin() const noexcept {
+    return const_iterator(segments_.data(), 0);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(segments_.data(), size_);
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept {
+    return segments_.size() * SegmentSize;
+  }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+  }
+
+  // Добавляет сегменты заранее, элементы не переносятся
+  void reserve(size_type new_capacity) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    while (capacity() < new_capacity) {
+      add_segment();
+    }
+  }
+
+  // Отдает пустые сегменты в конце
+  void shrink_to_fit() {
+    size_type used = (size_ + SegmentSize - 1) / SegmentSize;
+    while (segments_.size() > used) {
+      alloc_traits::deallocate(alloc_, segments_.back(), SegmentSize);
+      segments_.pop_back();
+    }
+    segments_.shrink_to_fit();
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity()) {
+      // новый сегмент не трогает старые, args остаются действительными
+      add_segment();
+    }
+    T *slot = &element(size_);
+    alloc_traits::construct(alloc_, slot, std::forward<Args>(args)...);
+    size_++;
+    return *slot;
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      size_--;
+      alloc_traits::destroy(alloc_, &element(size_));
+    }
+  }
+
+  // Удаляет элементы, сегменты остаются для следующих push_back
+  void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value ||
+                  !allocator_constructs_plainly<Allocator, T>::value) {
+      while (size_ > 0) {
+        pop_back();
+      }
+    }
+    size_ = 0;
+  }
+
+  void resize(size_type n) {
+    reserve(n);
+    while (size_ < n) {
+      emplace_back();
+    }
+    while (size_ > n) {
+      pop_back();
+    }
+  }
+
+  void resize(size_type n, const_reference value) {
+    reserve(n);
+    while (size_ < n) {
+      emplace_back(value);
+    }
+    while (size_ > n) {
+      pop_back();
+    }
+  }
+
+  void swap(segmented_vector &other) noexcept {
+    alloc_on_swap(alloc_, other.alloc_);
+    segments_.swap(other.segments_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  static constexpr size_type kShift = [] {
+    size_type shift = 0;
+    while ((size_type(1) << shift) < SegmentSize) {
+      shift++;
+    }
+    return shift;
+  }();
+  static constexpr size_type kMask = SegmentSize - 1;
+
+  vector<T *, directory_allocator> segments_;
+  size_type size_;
+  Allocator alloc_;
+
+  T &element(size_type pos) const noexcept {
+    return segments_[pos >> kShift][pos & kMask];
+  }
+
+  void add_segment() {
+    T *segment = alloc_traits::allocate(alloc_, SegmentSize);
+    try {
+      segments_.push_back(segment);
+    } catch (...) {
+      alloc_traits::deallocate(alloc_, segment, SegmentSize);
+      throw;
+    }
+  }
+
+  template <typename InputIt>
+  void append_copy(InputIt first, InputIt last, size_type count) {
+    reserve(size_ + count);
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+
+  void release() noexcept {
+    clear();
+    for (T *segment : segments_) {
+      alloc_traits::deallocate(alloc_, segment, SegmentSize);
+    }
+    segments_.clear();
+  }
+
+  // Итератор произвольного доступа: указатель на каталог и индекс. Каталог
+  // может переехать при росте, поэтому итератор держит адрес его буфера
+  // и после push_back, добавившего сегмент, становится недействительным.
+  template <bool Const>
+  class SegmentIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    SegmentIterator() noexcept : segments_(nullptr), pos_(0) {}
+    SegmentIterator(T *const *segments, size_type pos) noexcept
+        : segments_(segments), pos_(pos) {}
+    // iterator -> const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    SegmentIterator(const SegmentIterator<false> &other) noexcept
+        : segments_(other.segments_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept {
+      return segments_[pos_ >> kShift][pos_ & kMask];
+    }
+    pointer operator->() const noexcept { return &**this; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    SegmentIterator &operator++() noexcept {
+      pos_++;
+      return *this;
+    }
+    SegmentIterator operator++(int) noexcept {
+      SegmentIterator tmp(*this);
+      pos_++;
+      return tmp;
+    }
+    SegmentIterator &operator--() noexcept {
+      pos_--;
+      return *this;
+    }
+    SegmentIterator operator--(int) noexcept {
+      SegmentIterator tmp(*this);
+      pos_--;
+      return tmp;
+    }
+    SegmentIterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    SegmentIterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    friend SegmentIterator operator+(SegmentIterator it,
+                                     difference_type n) noexcept {
+      return it += n;
+    }
+    friend SegmentIterator operator+(difference_type n,
+                                     SegmentIterator it) noexcept {
+      return it += n;
+    }
+    friend SegmentIterator operator-(SegmentIterator it,
+                                     difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const SegmentIterator &a,
+                                     const SegmentIterator &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+
+    bool operator==(const SegmentIterator &other) const noexcept {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const SegmentIterator &other) const noexcept {
+      return pos_ != other.pos_;
+    }
+    bool operator<(const SegmentIterator &other) const noexcept {
+      return pos_ < other.pos_;
+    }
+    bool operator>(const SegmentIterator &other) const noexcept {
+      return pos_ > other.pos_;
+    }
+    bool operator<=(const SegmentIterator &other) const noexcept {
+      return pos_ <= other.pos_;
+    }
+    bool operator>=(const SegmentIterator &other) const noexcept {
+      return pos_ >= other.pos_;
+    }
+
+   private:
+    friend class SegmentIterator<!Const>;
+
+    T *const *segments_;
+    size_type pos_;
+  };
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_SEGMENTED_VECTOR_H
@@ -0,0 +1,482 @@
+#ifndef CONTAINERS_SERIALIZE_H
+#define CONTAINERS_SERIALIZE_H
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "../containersplus/array.h"
+#include "RBT.h"
+#include "bit_vector.h"
+#include "map.h"
+#include "set.h"
+#include "vector.h"
+
+// Двоичное сохранение и загрузка контейнеров с тривиально копируемыми
+// элементами: s21::vector, s21::array, s21::set и s21::map. Упакованный
+// s21::vector<bool> сохраняется словами с битами.
+//
+// Формат: заголовок (serial_header, 32 байта) и за ним элементы байтами
+// памяти. Заголовок хранит сигнатуру, версию формата, вид контейнера,
+// метку порядка байт, sizeof ключа и значения и число элементов; при
+// загрузке все это сверяется, и чужие данные бросают std::runtime_error.
+// Порядок байт - родной для машины, файл переносим только между машинами
+// с одинаковым порядком байт и раскладкой типов.
+//
+//   vector, array - тело пишется одним write() прямо из data(), а читается
+//                   одним read() прямо в буфер вектора, без промежуточных
+//                   копий. Для файлового дескриптора заголовок и тело
+//                   уходят одним writev()
+//   set, map      - элементы пишутся в порядке возрастания ключей (ключ,
+//                   затем значение) блоками по kSerialChunkBytes. Загрузка
+//                   строит дерево за O(n) через assign_sorted, без поиска
+//                   места и балансировки для каждого ключа
+//
+// Ошибки записи и чтения потока бросают std::runtime_error, ошибки
+// дескриптора - std::system_error. Если загрузка не удалась, контейнер
+// остается пустым.
+//
+//   std::ofstream out("ids.bin", std::ios::binary);
+//   s21::serialize(out, ids);
+//   ...
+//   s21::deserialize(in, ids);
+
+namespace s21 {
+
+enum class serial_kind : std::uint16_t {
+  vector = 1,
+  array = 2,
+  set = 3,
+  map = 4,
+  bit_vector = 5
+};
+
+struct serial_header {
+  char magic[6];
+  std::uint16_t version;
+  serial_kind kind;
+  std::uint16_t byte_order;
+  std::uint32_t key_size;
+  std::uint32_t value_size;
+  std::uint32_t reserved;
+  std::uint64_t count;
+};
+static_assert(sizeof(serial_header) == 32, "serial_header must be packed");
+
+constexpr std::uint16_t kSerialVersion = 1;
+// Размер блока, которым пишутся и читаются элементы set и map
+constexpr std::size_t kSerialChunkBytes = 64 * 1024;
+
+namespace detail {
+
+constexpr char kSerialMagic[6] = {'s', '2', '1', 's', 'e', 'r'};
+constexpr std::uint16_t kSerialByteOrder = 0x0102;
+
+inline serial_header make_header(serial_kind kind, std::size_t key_size,
+                                 std::size_t value_size, std::size_t count) {
+  serial_header header{};
+  std::memcpy(header.magic, kSerialMagic, sizeof(kSerialMagic));
+  header.version = kSerialVersion;
+  header.kind = kind;
+  header.byte_order = kSerialByteOrder;
+  header.key_size = static_cast<std::uint32_t>(key_size);
+  header.value_size = static_cast<std::uint32_t>(value_size);
+  header.count = count;
+  return header;
+}
+
+inline void check_header(const serial_header &header, serial_kind kind,
+                         std::size_t key_size, std::size_t value_size) {
+  if (std::memcmp(header.magic, kSerialMagic, sizeof(kSerialMagic)) != 0) {
+    throw std::runtime_error("serialize: not a serialized container");
+  }
+  if (header.version != kSerialVersion) {
+    throw std::runtime_error("serialize: unsupported format version");
+  }
+  if (header.byte_order != kSerialByteOrder) {
+    throw std::runtime_error("serialize: foreign byte order");
+  }
+  if (header.kind != kind) {
+    throw std::runtime_error("serialize: container kind mismatch");
+  }
+  if (header.key_size != key_size || header.value_size != value_size) {
+    throw std::runtime_error("serialize: element size mismatch");
+  }
+}
+
+// Приемники и источники байт: поток или файловый дескриптор
+class stream_sink {
+ public:
+  explicit stream_sink(std::ostream &os) : os_(os) {}
+
+  void write(const void *data, std::size_t bytes) {
+    os_.write(static_cast<const char *>(data),
+              static_cast<std::streamsize>(bytes));
+    if (!os_) {
+      throw std::runtime_error("serialize: stream write failed");
+    }
+  }
+
+  void write(const void *head, std::size_t head_bytes, const void *body,
+             std::size_t body_bytes) {
+    write(head, head_bytes);
+    write(body, body_bytes);
+  }
+
+ private:
+  std::ostream &os_;
+};
+
+class fd_sink {
+ public:
+  explicit fd_sink(int fd) : fd_(fd) {}
+
+  void write(const void *data, std::size_t bytes) {
+    write(data, bytes, nullptr, 0);
+  }
+
+  // Оба куска уходят одним системным вызовом; короткая запись дописывается
+  void write(const void *head, std::size_t head_bytes, const void *body,
+             std::size_t body_bytes) {
+    iovec parts[2] = {{const_cast<void *>(head), head_bytes},
+                      {const_cast<void *>(body), body_bytes}};
+    iovec *part = parts;
+    int count = body_bytes ? 2 : 1;
+    while (count > 0) {
+      ssize_t written = ::writev(fd_, part, count);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw std::system_error(errno, std::generic_category(),
+                                "serialize: writev");
+      }
+      std::size_t left = static_cast<std::size_t>(written);
+      while (count > 0 && left >= part->iov_len) {
+        left -= part->iov_len;
+        part++;
+        count--;
+      }
+      if (count > 0) {
+        part->iov_base = static_cast<char *>(part->iov_base) + left;
+        part->iov_len -= left;
+      }
+    }
+  }
+
+ private:
+  int fd_;
+};
+
+class stream_source {
+ public:
+  explicit stream_source(std::istream &is) : is_(is) {}
+
+  void read(void *data, std::size_t bytes) {
+    is_.read(static_cast<char *>(data), static_cast<std::streamsize>(bytes));
+    if (static_cast<std::size_t>(is_.gcount()) != bytes) {
+      throw std::runtime_error("serialize: unexpected end of data");
+    }
+  }
+
+ private:
+  std::istream &is_;
+};
+
+class fd_source {
+ public:
+  explicit fd_source(int fd) : fd_(fd) {}
+
+  void read(void *data, std::size_t bytes) {
+    char *out = static_cast<char *>(data);
+    while (bytes > 0) {
+      ssize_t got = ::read(fd_, out, bytes);
+      if (got < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw std::system_error(errno, std::generic_category(),
+                                "serialize: read");
+      }
+      if (got == 0) {
+        throw std::runtime_error("serialize: unexpected end of data");
+      }
+      out += got;
+      bytes -= static_cast<std::size_t>(got);
+    }
+  }
+
+ private:
+  int fd_;
+};
+
+// Записи дерева копятся в блоке и уходят в приемник по kSerialChunkBytes.
+// Заголовок кладется в начало первого блока, так что небольшой set или map
+// пишется одним вызовом.
+template <typename Sink>
+class chunk_writer {
+ public:
+  chunk_writer(Sink &sink, const serial_header &header) : sink_(sink) {
+    buffer_.resize(kSerialChunkBytes);
+    std::memcpy(buffer_.data(), &header, sizeof(header));
+    used_ = sizeof(header);
+  }
+
+  void put(const void *data, std::size_t bytes) {
+    if (used_ + bytes > buffer_.size()) {
+      flush();
+    }
+    std::memcpy(buffer_.data() + used_, data, bytes);
+    used_ += bytes;
+  }
+
+  void flush() {
+    if (used_ > 0) {
+      sink_.write(buffer_.data(), used_);
+      used_ = 0;
+    }
+  }
+
+ private:
+  Sink &sink_;
+  vector<char> buffer_;
+  std::size_t used_ = 0;
+};
+
+// Читает записи дерева блоками, не заглядывая за конец данных контейнера
+template <typename Source>
+class chunk_reader {
+ public:
+  chunk_reader(Source &source, std::size_t total_bytes)
+      : source_(source), left_(total_bytes) {
+    buffer_.resize(kSerialChunkBytes);
+  }
+
+  void get(void *data, std::size_t bytes) {
+    if (pos_ + bytes > filled_) {
+      refill();
+    }
+    std::memcpy(data, buffer_.data() + pos_, bytes);
+    pos_ += bytes;
+  }
+
+ private:
+  void refill() {
+    std::size_t rest = filled_ - pos_;
+    std::memmove(buffer_.data(), buffer_.data() + pos_, rest);
+    std::size_t want = std::min(buffer_.size() - rest, left_);
+    source_.read(buffer_.data() + rest, want);
+    left_ -= want;
+    filled_ = rest + want;
+    pos_ = 0;
+  }
+
+  Source &source_;
+  vector<char> buffer_;
+  std::size_t left_;
+  std::size_t pos_ = 0;
+  std::size_t filled_ = 0;
+};
+
+template <typename T>
+constexpr void check_element() {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "serialize stores elements as raw bytes");
+}
+
+template <typename Source>
+std::size_t read_count(Source &source, serial_kind kind, std::size_t key_size,
+                       std::size_t value_size) {
+  serial_header header;
+  source.read(&header, sizeof(header));
+  check_header(header, kind, key_size, value_size);
+  std::size_t record = key_size + value_size;
+  if (header.count >
+      std::numeric_limits<std::size_t>::max() / (record ? record : 1)) {
+    throw std::runtime_error("serialize: element count is too large");
+  }
+  return static_cast<std::size_t>(header.count);
+}
+
+template <typename Sink, typename T, typename Allocator>
+void save(Sink &sink, const vector<T, Allocator> &v) {
+  check_element<T>();
+  serial_header header =
+      make_header(serial_kind::vector, 0, sizeof(T), v.size());
+  sink.write(&header, sizeof(header), v.data(), v.size() * sizeof(T));
+}
+
+template <typename Source, typename T, typename Allocator>
+void load(Source &source, vector<T, Allocator> &v) {
+  check_element<T>();
+  v.clear();
+  std::size_t count = read_count(source, serial_kind::vector, 0, sizeof(T));
+  if (count > v.max_size()) {
+    throw std::runtime_error("serialize: element count is too large");
+  }
+  v.resize(count);
+  try {
+    source.read(v.data(), count * sizeof(T));
+  } catch (...) {
+    v.clear();
+    throw;
+  }
+}
+
+// Упакованный vector<bool>: count - число битов, тело - слова целиком
+template <typename Sink, typename Allocator>
+void save(Sink &sink, const vector<bool, Allocator> &v) {
+  using word_type = typename vector<bool, Allocator>::word_type;
+  serial_header header =
+      make_header(serial_kind::bit_vector, 0, sizeof(word_type), v.size());
+  sink.write(&header, sizeof(header), v.words(),
+             v.word_count() * sizeof(word_type));
+}
+
+template <typename Source, typename Allocator>
+void load(Source &source, vector<bool, Allocator> &v) {
+  using word_type = typename vector<bool, Allocator>::word_type;
+  v.clear();
+  std::size_t count =
+      read_count(source, serial_kind::bit_vector, 0, sizeof(word_type));
+  if (count > v.max_size()) {
+    throw std::runtime_error("serialize: element count is too large");
+  }
+  v.resize(count);
+  try {
+    source.read(v.words(), v.word_count() * sizeof(word_type));
+  } catch (...) {
+    v.clear();
+    throw;
+  }
+  // resize до того же размера обнуляет биты за size() в последнем слове
+  v.resize(count);
+}
+
+template <typename Sink, typename T, std::size_t N>
+void save(Sink &sink, const array<T, N> &a) {
+  check_element<T>();
+  serial_header header = make_header(serial_kind::array, 0, sizeof(T), N);
+  sink.write(&header, sizeof(header), a.data(), N * sizeof(T));
+}
+
+// У массива размер фиксирован, при ошибке его содержимое не определено
+template <typename Source, typename T, std::size_t N>
+void load(Source &source, array<T, N> &a) {
+  check_element<T>();
+  if (read_count(source, serial_kind::array, 0, sizeof(T)) != N) {
+    throw std::runtime_error("serialize: array size mismatch");
+  }
+  source.read(a.data(), N * sizeof(T));
+}
+
+template <typename Sink, typename Key, typename Allocator>
+void save(Sink &sink, const set<Key, Allocator> &s) {
+  check_element<Key>();
+  chunk_writer<Sink> out(
+      sink, make_header(serial_kind::set, sizeof(Key), 0, s.size()));
+  for (auto it = s.begin(); it != s.end(); ++it) {
+    out.put(&it->key_, sizeof(Key));
+  }
+  out.flush();
+}
+
+template <typename Source, typename Key, typename Allocator>
+void load(Source &source, set<Key, Allocator> &s) {
+  check_element<Key>();
+  s.clear();
+  std::size_t count = read_count(source, serial_kind::set, sizeof(Key), 0);
+  chunk_reader<Source> in(source, count * sizeof(Key));
+  Key previous{};
+  bool first = true;
+  s.assign_sorted(count, [&] {
+    Key key;
+    in.get(&key, sizeof(Key));
+    if (!first && !(previous < key)) {
+      throw std::runtime_error("serialize: keys are not sorted");
+    }
+    previous = key;
+    first = false;
+    return key;
+  });
+}
+
+template <typename Sink, typename Key, typename T, typename Allocator>
+void save(Sink &sink, const map<Key, T, Allocator> &m) {
+  check_element<Key>();
+  check_element<T>();
+  chunk_writer<Sink> out(
+      sink, make_header(serial_kind::map, sizeof(Key), sizeof(T), m.size()));
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    out.put(&it->key_, sizeof(Key));
+    out.put(&it->value_, sizeof(T));
+  }
+  out.flush();
+}
+
+template <typename Source, typename Key, typename T, typename Allocator>
+void load(Source &source, map<Key, T, Allocator> &m) {
+  check_element<Key>();
+  check_element<T>();
+  m.clear();
+  std::size_t count =
+      read_count(source, serial_kind::map, sizeof(Key), sizeof(T));
+  chunk_reader<Source> in(source, count * (sizeof(Key) + sizeof(T)));
+  Key previous{};
+  bool first = true;
+  m.assign_sorted(count, [&] {
+    std::pair<Key, T> item;
+    in.get(&item.first, sizeof(Key));
+    in.get(&item.second, sizeof(T));
+    if (!first && !(previous < item.first)) {
+      throw std::runtime_error("serialize: keys are not sorted");
+    }
+    previous = item.first;
+    first = false;
+    return item;
+  });
+}
+
+}  // namespace detail
+
+template <typename Container>
+void serialize(std::ostream &os, const Container &c) {
+  detail::stream_sink sink(os);
+  detail::save(sink, c);
+}
+
+// Пишет в файловый дескриптор с текущей позиции
+template <typename Container>
+void serialize(int fd, const Container &c) {
+  detail::fd_sink sink(fd);
+  detail::save(sink, c);
+}
+
+template <typename Container>
+void deserialize(std::istream &is, Container &c) {
+  detail::stream_source source(is);
+  detail::load(source, c);
+}
+
+// Читает из файлового дескриптора ровно один контейнер
+template <typename Container>
+void deserialize(int fd, Container &c) {
+  detail::fd_source source(fd);
+  detail::load(source, c);
+}
+
+}  // namespace s21
+
+#endif  // CONTAINERS_SERIALIZE_H
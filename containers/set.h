@@ -3,46 +3,65 @@
 
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <utility>
 
 #include "RBT.h"
 
 namespace s21 {
 
-template <typename Key>
+template <typename Key, typename Allocator = std::allocator<Key>>
 class set {
  public:
   using key_type = Key;
   using value_type = key_type;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RBTree<key_type, value_type>::TreeIterator;
-  using const_iterator =
-      typename RBTree<key_type, value_type>::ConstTreeIterator;
+  using allocator_type = Allocator;
+  using tree_type = RBTree<key_type, value_type, Allocator>;
+  using iterator = typename tree_type::TreeIterator;
+  using const_iterator = typename tree_type::ConstTreeIterator;
   using size_type = std::size_t;
 
-  set() noexcept = default;
+  set() = default;
 
-  set(std::initializer_list<value_type> const &items) {
+  explicit set(const Allocator &alloc) : tree_(alloc) {}
+
+  set(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator())
+      : tree_(alloc) {
     for (const auto &item : items) {
       insert(item);
     }
   }
 
-  set(const set &s) {
+  set(const set &s)
+      : tree_(std::allocator_traits<Allocator>::
+                  select_on_container_copy_construction(s.get_allocator())) {
     for (const auto &pair : s) {
       insert(pair);
     }
   }
 
-  set(set &&s) noexcept {
+  set(const set &s, const Allocator &alloc) : tree_(s.tree_, alloc) {}
+
+  set(set &&s) noexcept : tree_(s.tree_.get_allocator()) {
     clear();
     swap(s);
   }
 
+  set(set &&s, const Allocator &alloc) : tree_(std::move(s.tree_), alloc) {}
+
   ~set() noexcept = default;
 
-  set operator=(set &&s) {
+  set &operator=(const set &s) {
+    if (this != &s) {
+      tree_ = s.tree_;
+    }
+    return *this;
+  }
+
+  set &operator=(set &&s) {
     if (this != &s) {
       tree_ = std::move(s.tree_);
     }
@@ -54,9 +73,9 @@ class set {
 
   iterator end() const noexcept { return tree_.end(); }
 
-  bool empty() noexcept { return tree_.empty(); }
+  bool empty() const noexcept { return tree_.empty(); }
 
-  size_type size() noexcept { return tree_.size(); }
+  size_type size() const noexcept { return tree_.size(); }
 
   size_type max_size() noexcept {
     return std::numeric_limits<size_type>::max() / sizeof(value_type);
@@ -64,12 +83,26 @@ class set {
 
   void clear() noexcept { tree_.clear(); }
 
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
   std::pair<iterator, bool> insert(const value_type &value) {
-    using TreeNode = typename s21::RBTree<value_type, value_type>::TreeNode;
-    TreeNode *newNode = new TreeNode(value, value);
+    using TreeNode = typename tree_type::TreeNode;
+    TreeNode *newNode = tree_.createNode(value, value);
     return tree_.insertNode(newNode, tree_.root_);
   }
 
+  // Заменяет содержимое n ключами из next() за O(n). Ключи должны строго
+  // возрастать (так их пишет s21::serialize).
+  template <typename Source>
+  void assign_sorted(size_type n, Source next) {
+    tree_.buildSorted(n, [&next] {
+      key_type key = next();
+      return std::pair<key_type, key_type>(key, key);
+    });
+  }
+
   void erase(iterator pos) { tree_.erase(pos); }
 
   void swap(set &other) noexcept { tree_.swap(other.tree_); }
@@ -87,7 +120,7 @@ class set {
 
  private:
   // в сете нет пары ключ значение поэтому в дерево я передаю ключ ключ
-  RBTree<key_type, value_type> tree_;
+  tree_type tree_;
 };
 
 }  // namespace s21
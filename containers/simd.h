@@ -0,0 +1,497 @@
+#ifndef CONTAINERS_SIMD_H
+#define CONTAINERS_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define S21_SIMD_X86 0
+#endif
+
+// Векторизованные операции над непрерывными контейнерами s21 (vector,
+// small_vector, array): fill, find, count, min, max, sum и поэлементный
+// transform.
+//
+//   s21::vector<double> prices = ...;
+//   double total = s21::simd::sum(prices);
+//   auto it = s21::simd::find(prices, 0.0);
+//
+// Для int32_t, float и double есть ядра на SSE2 и AVX2. Набор инструкций
+// выбирается при запуске по возможностям процессора, остальные типы и
+// другие платформы идут через обычный цикл. min и max для float/double с
+// NaN в данных возвращают неопределенный из элементов результат.
+
+namespace s21 {
+namespace simd {
+
+enum class isa { scalar, sse2, avx2 };
+
+// Лучший набор инструкций, который поддерживает процессор
+inline isa best_isa() noexcept {
+#if S21_SIMD_X86
+  static const isa best =
+      __builtin_cpu_supports("avx2") ? isa::avx2 : isa::sse2;
+  return best;
+#else
+  return isa::scalar;
+#endif
+}
+
+namespace detail {
+inline isa &active_isa_ref() noexcept {
+  static isa active = best_isa();
+  return active;
+}
+}  // namespace detail
+
+inline isa active_isa() noexcept { return detail::active_isa_ref(); }
+
+// Ограничивает набор инструкций (для тестов и бенчмарков сравнения ядер).
+// Не потокобезопасно: вызывать до запуска рабочих потоков.
+inline isa use_isa(isa wanted) noexcept {
+  isa chosen = wanted < best_isa() ? wanted : best_isa();
+  detail::active_isa_ref() = chosen;
+  return chosen;
+}
+
+namespace detail {
+
+// Поэлементные операции transform, для которых есть свои ядра
+enum class arith { none, add, sub, mul };
+
+template <typename Op, typename T>
+constexpr arith arith_of() {
+  if constexpr (std::is_same<Op, std::plus<T>>::value ||
+                std::is_same<Op, std::plus<>>::value) {
+    return arith::add;
+  } else if constexpr (std::is_same<Op, std::minus<T>>::value ||
+                       std::is_same<Op, std::minus<>>::value) {
+    return arith::sub;
+  } else if constexpr (std::is_same<Op, std::multiplies<T>>::value ||
+                       std::is_same<Op, std::multiplies<>>::value) {
+    return arith::mul;
+  } else {
+    return arith::none;
+  }
+}
+
+namespace scalar {
+// Вектор из одного элемента: ядра превращаются в обычные циклы
+template <typename T>
+struct batch {
+  using type = T;
+  static constexpr std::size_t width = 1;
+  static T load(const T *p) { return *p; }
+  static void store(T *p, const T &v) { *p = v; }
+  static T set1(const T &x) { return x; }
+  static T zero() { return T(); }
+  static T add(const T &a, const T &b) { return a + b; }
+  static T sub(const T &a, const T &b) { return a - b; }
+  static T mul(const T &a, const T &b) { return a * b; }
+  static T min(const T &a, const T &b) { return b < a ? b : a; }
+  static T max(const T &a, const T &b) { return a < b ? b : a; }
+  static unsigned eq_mask(const T &a, const T &b) { return a == b; }
+  using counter = std::size_t;
+  static constexpr std::size_t counter_limit = SIZE_MAX;
+  static counter counter_zero() { return 0; }
+  static counter count_eq(counter c, const T &a, const T &b) {
+    return c + (a == b);
+  }
+  static std::size_t counter_total(counter c) { return c; }
+};
+
+#include "simd_kernels.h"
+}  // namespace scalar
+
+#if S21_SIMD_X86
+// SSE2 есть на любом x86-64, отдельный target не нужен
+namespace sse2 {
+template <typename T>
+struct batch;
+
+// Сумма дорожек счетчика (см. count в simd_kernels.h)
+inline std::size_t sum_epi32(__m128i c) {
+  alignas(16) std::uint32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), c);
+  return std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+}
+inline std::size_t sum_epi64(__m128i c) {
+  alignas(16) std::uint64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes), c);
+  return lanes[0] + lanes[1];
+}
+
+template <>
+struct batch<std::int32_t> {
+  using type = __m128i;
+  static constexpr std::size_t width = 4;
+  static type load(const std::int32_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static void store(std::int32_t *p, type v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+  }
+  static type set1(std::int32_t x) { return _mm_set1_epi32(x); }
+  static type zero() { return _mm_setzero_si128(); }
+  static type add(type a, type b) { return _mm_add_epi32(a, b); }
+  static type sub(type a, type b) { return _mm_sub_epi32(a, b); }
+  // mullo_epi32 тоже из SSE4.1: перемножаем четные и нечетные дорожки
+  // через mul_epu32 и собираем младшие половины
+  static type mul(type a, type b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  }
+  // min/max для int32 появились только в SSE4.1, выбираем по маске
+  static type min(type a, type b) {
+    __m128i a_greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(a_greater, b),
+                        _mm_andnot_si128(a_greater, a));
+  }
+  static type max(type a, type b) {
+    __m128i a_greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(a_greater, a),
+                        _mm_andnot_si128(a_greater, b));
+  }
+  static unsigned eq_mask(type a, type b) {
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+  }
+  // маска совпадения - это -1 в дорожке, вычитание прибавляет единицу
+  using counter = __m128i;
+  static constexpr std::size_t counter_limit = INT32_MAX;
+  static counter counter_zero() { return _mm_setzero_si128(); }
+  static counter count_eq(counter c, type a, type b) {
+    return _mm_sub_epi32(c, _mm_cmpeq_epi32(a, b));
+  }
+  static std::size_t counter_total(counter c) { return sum_epi32(c); }
+};
+
+template <>
+struct batch<float> {
+  using type = __m128;
+  static constexpr std::size_t width = 4;
+  static type load(const float *p) { return _mm_loadu_ps(p); }
+  static void store(float *p, type v) { _mm_storeu_ps(p, v); }
+  static type set1(float x) { return _mm_set1_ps(x); }
+  static type zero() { return _mm_setzero_ps(); }
+  static type add(type a, type b) { return _mm_add_ps(a, b); }
+  static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+  static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+  static type min(type a, type b) { return _mm_min_ps(a, b); }
+  static type max(type a, type b) { return _mm_max_ps(a, b); }
+  static unsigned eq_mask(type a, type b) {
+    return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+  }
+  using counter = __m128i;
+  static constexpr std::size_t counter_limit = INT32_MAX;
+  static counter counter_zero() { return _mm_setzero_si128(); }
+  static counter count_eq(counter c, type a, type b) {
+    return _mm_sub_epi32(c, _mm_castps_si128(_mm_cmpeq_ps(a, b)));
+  }
+  static std::size_t counter_total(counter c) { return sum_epi32(c); }
+};
+
+template <>
+struct batch<double> {
+  using type = __m128d;
+  static constexpr std::size_t width = 2;
+  static type load(const double *p) { return _mm_loadu_pd(p); }
+  static void store(double *p, type v) { _mm_storeu_pd(p, v); }
+  static type set1(double x) { return _mm_set1_pd(x); }
+  static type zero() { return _mm_setzero_pd(); }
+  static type add(type a, type b) { return _mm_add_pd(a, b); }
+  static type sub(type a, type b) { return _mm_sub_pd(a, b); }
+  static type mul(type a, type b) { return _mm_mul_pd(a, b); }
+  static type min(type a, type b) { return _mm_min_pd(a, b); }
+  static type max(type a, type b) { return _mm_max_pd(a, b); }
+  static unsigned eq_mask(type a, type b) {
+    return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+  }
+  using counter = __m128i;
+  static constexpr std::size_t counter_limit = INT64_MAX;
+  static counter counter_zero() { return _mm_setzero_si128(); }
+  static counter count_eq(counter c, type a, type b) {
+    return _mm_sub_epi64(c, _mm_castpd_si128(_mm_cmpeq_pd(a, b)));
+  }
+  static std::size_t counter_total(counter c) { return sum_epi64(c); }
+};
+
+#include "simd_kernels.h"
+}  // namespace sse2
+
+// Все функции до pop_options собираются с AVX2 и вызываются только если
+// процессор его поддерживает (см. best_isa)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2 {
+template <typename T>
+struct batch;
+
+inline std::size_t sum_epi32(__m256i c) {
+  alignas(32) std::uint32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), c);
+  std::size_t total = 0;
+  for (std::uint32_t lane : lanes) {
+    total += lane;
+  }
+  return total;
+}
+inline std::size_t sum_epi64(__m256i c) {
+  alignas(32) std::uint64_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), c);
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+template <>
+struct batch<std::int32_t> {
+  using type = __m256i;
+  static constexpr std::size_t width = 8;
+  static type load(const std::int32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static void store(std::int32_t *p, type v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+  static type set1(std::int32_t x) { return _mm256_set1_epi32(x); }
+  static type zero() { return _mm256_setzero_si256(); }
+  static type add(type a, type b) { return _mm256_add_epi32(a, b); }
+  static type sub(type a, type b) { return _mm256_sub_epi32(a, b); }
+  static type mul(type a, type b) { return _mm256_mullo_epi32(a, b); }
+  static type min(type a, type b) { return _mm256_min_epi32(a, b); }
+  static type max(type a, type b) { return _mm256_max_epi32(a, b); }
+  static unsigned eq_mask(type a, type b) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+  }
+  using counter = __m256i;
+  static constexpr std::size_t counter_limit = INT32_MAX;
+  static counter counter_zero() { return _mm256_setzero_si256(); }
+  static counter count_eq(counter c, type a, type b) {
+    return _mm256_sub_epi32(c, _mm256_cmpeq_epi32(a, b));
+  }
+  static std::size_t counter_total(counter c) { return sum_epi32(c); }
+};
+
+template <>
+struct batch<float> {
+  using type = __m256;
+  static constexpr std::size_t width = 8;
+  static type load(const float *p) { return _mm256_loadu_ps(p); }
+  static void store(float *p, type v) { _mm256_storeu_ps(p, v); }
+  static type set1(float x) { return _mm256_set1_ps(x); }
+  static type zero() { return _mm256_setzero_ps(); }
+  static type add(type a, type b) { return _mm256_add_ps(a, b); }
+  static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+  static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+  static type min(type a, type b) { return _mm256_min_ps(a, b); }
+  static type max(type a, type b) { return _mm256_max_ps(a, b); }
+  static unsigned eq_mask(type a, type b) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+  }
+  using counter = __m256i;
+  static constexpr std::size_t counter_limit = INT32_MAX;
+  static counter counter_zero() { return _mm256_setzero_si256(); }
+  static counter count_eq(counter c, type a, type b) {
+    return _mm256_sub_epi32(c,
+                            _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+  }
+  static std::size_t counter_total(counter c) { return sum_epi32(c); }
+};
+
+template <>
+struct batch<double> {
+  using type = __m256d;
+  static constexpr std::size_t width = 4;
+  static type load(const double *p) { return _mm256_loadu_pd(p); }
+  static void store(double *p, type v) { _mm256_storeu_pd(p, v); }
+  static type set1(double x) { return _mm256_set1_pd(x); }
+  static type zero() { return _mm256_setzero_pd(); }
+  static type add(type a, type b) { return _mm256_add_pd(a, b); }
+  static type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+  static type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+  static type min(type a, type b) { return _mm256_min_pd(a, b); }
+  static type max(type a, type b) { return _mm256_max_pd(a, b); }
+  static unsigned eq_mask(type a, type b) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+  }
+  using counter = __m256i;
+  static constexpr std::size_t counter_limit = INT64_MAX;
+  static counter counter_zero() { return _mm256_setzero_si256(); }
+  static counter count_eq(counter c, type a, type b) {
+    return _mm256_sub_epi64(c,
+                            _mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+  }
+  static std::size_t counter_total(counter c) { return sum_epi64(c); }
+};
+
+#include "simd_kernels.h"
+}  // namespace avx2
+#pragma GCC pop_options
+#endif  // S21_SIMD_X86
+
+// Типы, для которых есть свои SSE2/AVX2 ядра
+template <typename T>
+struct has_kernels
+    : std::bool_constant<std::is_same<T, std::int32_t>::value ||
+                         std::is_same<T, float>::value ||
+                         std::is_same<T, double>::value> {};
+
+// Вызывает ядро call из пространства имен активного набора инструкций
+#if S21_SIMD_X86
+#define S21_SIMD_DISPATCH(accelerated, call) \
+  do {                                       \
+    if constexpr (accelerated) {             \
+      switch (active_isa()) {                \
+        case isa::avx2:                      \
+          return avx2::call;                 \
+        case isa::sse2:                      \
+          return sse2::call;                 \
+        case isa::scalar:                    \
+          break;                             \
+      }                                      \
+    }                                        \
+    return scalar::call;                     \
+  } while (false)
+#else
+#define S21_SIMD_DISPATCH(accelerated, call) return scalar::call
+#endif
+
+template <typename T>
+void fill(T *p, std::size_t n, const T &value) {
+  S21_SIMD_DISPATCH(has_kernels<T>::value, fill(p, n, value));
+}
+
+template <typename T>
+std::size_t find(const T *p, std::size_t n, const T &value) {
+  S21_SIMD_DISPATCH(has_kernels<T>::value, find(p, n, value));
+}
+
+template <typename T>
+std::size_t count(const T *p, std::size_t n, const T &value) {
+  S21_SIMD_DISPATCH(has_kernels<T>::value, count(p, n, value));
+}
+
+template <typename T>
+T min(const T *p, std::size_t n) {
+  S21_SIMD_DISPATCH(has_kernels<T>::value, min(p, n));
+}
+
+template <typename T>
+T max(const T *p, std::size_t n) {
+  S21_SIMD_DISPATCH(has_kernels<T>::value, max(p, n));
+}
+
+template <typename T>
+T sum(const T *p, std::size_t n) {
+  S21_SIMD_DISPATCH(has_kernels<T>::value, sum(p, n));
+}
+
+template <arith Op, typename T>
+void elementwise(const T *a, const T *b, T *out, std::size_t n) {
+  S21_SIMD_DISPATCH(has_kernels<T>::value, elementwise<Op>(a, b, out, n));
+}
+
+#undef S21_SIMD_DISPATCH
+
+template <typename Container>
+void check_not_empty(const Container &c, const char *what) {
+  if (c.size() == 0) {
+    throw std::out_of_range(what);
+  }
+}
+
+template <typename In, typename Out>
+void check_same_size(const In &in, const Out &out) {
+  if (in.size() != out.size()) {
+    throw std::invalid_argument("simd::transform: sizes differ");
+  }
+}
+
+// Изменяемый контейнер передается по пересылающей ссылке, чтобы годились и
+// временные виды вроде s21::span(v).first(n)
+template <typename Container>
+using value_type_t = typename std::remove_reference_t<Container>::value_type;
+}  // namespace detail
+
+template <typename Container>
+void fill(Container &&c, const detail::value_type_t<Container> &value) {
+  detail::fill(c.data(), c.size(), value);
+}
+
+// Указатель на первый элемент, равный value, или на конец контейнера
+template <typename Container>
+auto find(Container &&c, const detail::value_type_t<Container> &value) {
+  auto *first = c.data();
+  return first + detail::find<detail::value_type_t<Container>>(
+                     first, c.size(), value);
+}
+
+template <typename Container>
+std::size_t count(const Container &c,
+                  const typename Container::value_type &value) {
+  return detail::count(c.data(), c.size(), value);
+}
+
+template <typename Container>
+typename Container::value_type min(const Container &c) {
+  detail::check_not_empty(c, "simd::min: container is empty");
+  return detail::min(c.data(), c.size());
+}
+
+template <typename Container>
+typename Container::value_type max(const Container &c) {
+  detail::check_not_empty(c, "simd::max: container is empty");
+  return detail::max(c.data(), c.size());
+}
+
+template <typename Container>
+typename Container::value_type sum(const Container &c) {
+  return detail::sum(c.data(), c.size());
+}
+
+// out[i] = op(in[i]). Произвольную op нельзя встроить в ядро, собранное
+// под другой набор инструкций, поэтому это обычный цикл: его векторизует
+// компилятор вызывающего кода (при -O3). Размеры контейнеров должны
+// совпадать, in и out могут быть одним контейнером.
+template <typename In, typename Out, typename Op>
+void transform(const In &in, Out &&out, Op op) {
+  detail::check_same_size(in, out);
+  const auto *first = in.data();
+  auto *dest = out.data();
+  for (std::size_t i = 0; i < in.size(); i++) {
+    dest[i] = op(first[i]);
+  }
+}
+
+// out[i] = op(a[i], b[i]). Для std::plus, std::minus и std::multiplies
+// над int32_t, float и double работают SSE2/AVX2 ядра.
+template <typename In1, typename In2, typename Out, typename Op>
+void transform(const In1 &a, const In2 &b, Out &&out, Op op) {
+  detail::check_same_size(a, b);
+  detail::check_same_size(a, out);
+  using T = detail::value_type_t<Out>;
+  constexpr detail::arith kind = detail::arith_of<Op, T>();
+  if constexpr (kind != detail::arith::none &&
+                std::is_same<typename In1::value_type, T>::value &&
+                std::is_same<typename In2::value_type, T>::value) {
+    detail::elementwise<kind>(a.data(), b.data(), out.data(), a.size());
+  } else {
+    const auto *x = a.data();
+    const auto *y = b.data();
+    auto *dest = out.data();
+    for (std::size_t i = 0; i < a.size(); i++) {
+      dest[i] = op(x[i], y[i]);
+    }
+  }
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // CONTAINERS_SIMD_H
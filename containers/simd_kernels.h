@@ -0,0 +1,166 @@
+// Ядра simd.h, общие для всех наборов инструкций. Файл намеренно без
+// include guard: simd.h подключает его в пространства имен scalar, sse2 и
+// avx2, и в каждом ядра собираются со своим batch<T> - вектором из
+// batch<T>::width элементов и операциями над ним. Отдельно не подключать.
+
+template <typename B, typename T, typename Reduce>
+inline T reduce_lanes(typename B::type v, Reduce reduce) {
+  if constexpr (B::width == 1) {
+    return v;
+  } else {
+    alignas(64) T lanes[B::width];
+    B::store(lanes, v);
+    T result = lanes[0];
+    for (std::size_t i = 1; i < B::width; i++) {
+      result = reduce(result, lanes[i]);
+    }
+    return result;
+  }
+}
+
+template <typename T>
+inline void fill(T *p, std::size_t n, const T &value) {
+  using B = batch<T>;
+  const typename B::type v = B::set1(value);
+  std::size_t i = 0;
+  for (; i + B::width <= n; i += B::width) {
+    B::store(p + i, v);
+  }
+  for (; i < n; i++) {
+    p[i] = value;
+  }
+}
+
+// Индекс первого элемента, равного value, или n
+template <typename T>
+inline std::size_t find(const T *p, std::size_t n, const T &value) {
+  using B = batch<T>;
+  const typename B::type v = B::set1(value);
+  std::size_t i = 0;
+  for (; i + B::width <= n; i += B::width) {
+    unsigned mask = B::eq_mask(B::load(p + i), v);
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  for (; i < n; i++) {
+    if (p[i] == value) {
+      return i;
+    }
+  }
+  return n;
+}
+
+// Совпадения копятся в счетчиках по дорожкам (без popcount, которого нет в
+// SSE2) и сбрасываются в итог раньше, чем счетчик дорожки переполнится
+template <typename T>
+inline std::size_t count(const T *p, std::size_t n, const T &value) {
+  using B = batch<T>;
+  const typename B::type v = B::set1(value);
+  std::size_t result = 0;
+  std::size_t i = 0;
+  while (i + B::width <= n) {
+    typename B::counter counter = B::counter_zero();
+    std::size_t block_end = n - (n - i) % B::width;
+    if ((block_end - i) / B::width > B::counter_limit) {
+      block_end = i + B::counter_limit * B::width;
+    }
+    for (; i < block_end; i += B::width) {
+      counter = B::count_eq(counter, B::load(p + i), v);
+    }
+    result += B::counter_total(counter);
+  }
+  for (; i < n; i++) {
+    result += p[i] == value;
+  }
+  return result;
+}
+
+// min и max ожидают n > 0
+template <typename T>
+inline T min(const T *p, std::size_t n) {
+  using B = batch<T>;
+  T result = p[0];
+  std::size_t i = 0;
+  if (n >= B::width) {
+    typename B::type acc = B::load(p);
+    for (i = B::width; i + B::width <= n; i += B::width) {
+      acc = B::min(acc, B::load(p + i));
+    }
+    result = reduce_lanes<B, T>(
+        acc, [](const T &a, const T &b) { return b < a ? b : a; });
+  }
+  for (; i < n; i++) {
+    if (p[i] < result) {
+      result = p[i];
+    }
+  }
+  return result;
+}
+
+template <typename T>
+inline T max(const T *p, std::size_t n) {
+  using B = batch<T>;
+  T result = p[0];
+  std::size_t i = 0;
+  if (n >= B::width) {
+    typename B::type acc = B::load(p);
+    for (i = B::width; i + B::width <= n; i += B::width) {
+      acc = B::max(acc, B::load(p + i));
+    }
+    result = reduce_lanes<B, T>(
+        acc, [](const T &a, const T &b) { return a < b ? b : a; });
+  }
+  for (; i < n; i++) {
+    if (result < p[i]) {
+      result = p[i];
+    }
+  }
+  return result;
+}
+
+// Сумма по B::width независимым дорожкам: для float и double порядок
+// сложения отличается от последовательного, результат может отличаться в
+// последних битах
+template <typename T>
+inline T sum(const T *p, std::size_t n) {
+  using B = batch<T>;
+  typename B::type acc = B::zero();
+  std::size_t i = 0;
+  for (; i + B::width <= n; i += B::width) {
+    acc = B::add(acc, B::load(p + i));
+  }
+  T result = reduce_lanes<B, T>(
+      acc, [](const T &a, const T &b) { return a + b; });
+  for (; i < n; i++) {
+    result += p[i];
+  }
+  return result;
+}
+
+// out[i] = a[i] op b[i] для op из enum arith. out может совпадать с a или b.
+template <arith Op, typename T>
+inline void elementwise(const T *a, const T *b, T *out, std::size_t n) {
+  using B = batch<T>;
+  std::size_t i = 0;
+  for (; i + B::width <= n; i += B::width) {
+    typename B::type x = B::load(a + i);
+    typename B::type y = B::load(b + i);
+    if constexpr (Op == arith::add) {
+      B::store(out + i, B::add(x, y));
+    } else if constexpr (Op == arith::sub) {
+      B::store(out + i, B::sub(x, y));
+    } else {
+      B::store(out + i, B::mul(x, y));
+    }
+  }
+  for (; i < n; i++) {
+    if constexpr (Op == arith::add) {
+      out[i] = a[i] + b[i];
+    } else if constexpr (Op == arith::sub) {
+      out[i] = a[i] - b[i];
+    } else {
+      out[i] = a[i] * b[i];
+    }
+  }
+}
@@ -0,0 +1,200 @@
+#ifndef CONTAINERS_SMALL_VECTOR_H
+#define CONTAINERS_SMALL_VECTOR_H
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "memory.h"
+#include "vector_base.h"
+
+namespace s21 {
+// Вектор, который хранит первые N элементов внутри себя и идет в кучу
+// только когда их становится больше. Интерфейс тот же, что у s21::vector.
+//
+// Пока элементы во внутреннем буфере, перемещение small_vector переносит
+// их по одному (для тривиально перемещаемых типов - одним memcpy буфера),
+// а не отдает указатель, как обычный вектор.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class small_vector : public detail::vector_base<small_vector<T, N, Allocator>,
+                                                T, Allocator> {
+  static_assert(N > 0, "use s21::vector for N == 0");
+
+  using base = detail::vector_base<small_vector, T, Allocator>;
+  friend base;
+
+ public:
+  using typename base::allocator_type;
+  using typename base::const_iterator;
+  using typename base::const_reference;
+  using typename base::iterator;
+  using typename base::reference;
+  using typename base::size_type;
+  using typename base::value_type;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_vector() : small_vector(Allocator()) {}
+
+  explicit small_vector(const Allocator &alloc)
+      // inline_data() - метод, до конструирования базы его звать нельзя
+      : base(reinterpret_cast<T *>(inline_), N, alloc) {}
+
+  explicit small_vector(size_type n, const Allocator &alloc = Allocator())
+      : small_vector(alloc) {
+    this->resize(n);
+  }
+
+  small_vector(std::initializer_list<value_type> const &items,
+               const Allocator &alloc = Allocator())
+      : small_vector(alloc) {
+    this->insert(this->begin(), items.begin(), items.end());
+  }
+
+  small_vector(const small_vector &v)
+      : small_vector(
+            alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+    this->insert(this->begin(), v.data_, v.data_ + v.size_);
+  }
+
+  small_vector(const small_vector &v, const Allocator &alloc)
+      : small_vector(alloc) {
+    this->insert(this->begin(), v.data_, v.data_ + v.size_);
+  }
+
+  small_vector(small_vector &&v) : small_vector(v.alloc_) { take(v); }
+
+  small_vector(small_vector &&v, const Allocator &alloc)
+      : small_vector(alloc) {
+    *this = std::move(v);
+  }
+
+  ~small_vector() { release(); }
+
+  small_vector &operator=(const small_vector &v) {
+    if (this != &v) {
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (alloc_ != v.alloc_) {
+          // память выделена старым аллокатором, им и освобождается
+          release();
+        }
+      }
+      this->clear();
+      alloc_on_copy(alloc_, v.alloc_);
+      this->insert(this->begin(), v.data_, v.data_ + v.size_);
+    }
+    return *this;
+  }
+
+  small_vector &operator=(small_vector &&v) {
+    if (this != &v) {
+      if (alloc_can_steal(alloc_, v.alloc_)) {
+        release();
+        alloc_on_move(alloc_, v.alloc_);
+        take(v);
+      } else {
+        // буфер v принадлежит чужому аллокатору, переносим элементы
+        this->clear();
+        this->insert(this->begin(), std::make_move_iterator(v.data_),
+                     std::make_move_iterator(v.data_ + v.size_));
+        v.clear();
+      }
+    }
+    return *this;
+  }
+
+  // true, пока элементы лежат во внутреннем буфере
+  bool is_inline() const noexcept { return data_ == inline_data(); }
+
+  // Если элементы помещаются во внутренний буфер, куча освобождается
+  void shrink_to_fit() {
+    if (capacity_ > size_ && !is_inline()) {
+      relocate(size_ > N ? size_ : N);
+    }
+  }
+
+  void swap(small_vector &other) {
+    if (!is_inline() && !other.is_inline()) {
+      alloc_on_swap(alloc_, other.alloc_);
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    } else {
+      small_vector tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+  }
+
+ private:
+  using typename base::alloc_traits;
+  using base::alloc_;
+  using base::capacity_;
+  using base::data_;
+  using base::kRelocateBytes;
+  using base::kShiftInPlace;
+  using base::move_into;
+  using base::relocate;
+  using base::size_;
+
+  T *inline_data() noexcept { return reinterpret_cast<T *>(inline_); }
+  const T *inline_data() const noexcept {
+    return reinterpret_cast<const T *>(inline_);
+  }
+
+  // Новый буфер на n элементов: внутренний, если помещаются и он не занят
+  // текущими элементами, иначе из кучи
+  T *allocate(size_type n) {
+    return n <= N && !is_inline() ? inline_data()
+                                  : alloc_traits::allocate(alloc_, n);
+  }
+  void deallocate(T *p, size_type n) noexcept {
+    if (p != inline_data()) {
+      alloc_traits::deallocate(alloc_, p, n);
+    }
+  }
+  // realloc годится, только пока и старый, и новый буфер в куче
+  bool can_reallocate(size_type new_capacity) const noexcept {
+    return !is_inline() && new_capacity > N;
+  }
+
+  // Разрушает элементы, отдает кучу аллокатору и возвращается к
+  // внутреннему буферу
+  void release() noexcept {
+    this->clear();
+    if (!is_inline()) {
+      alloc_traits::deallocate(alloc_, data_, capacity_);
+      data_ = inline_data();
+      capacity_ = N;
+    }
+  }
+
+  // Забирает содержимое v в пустой вектор с внутренним буфером. Кучу v
+  // отдает целиком, элементы из внутреннего буфера переносятся.
+  void take(small_vector &v) noexcept(kShiftInPlace) {
+    if (!v.is_inline()) {
+      data_ = v.data_;
+      size_ = v.size_;
+      capacity_ = v.capacity_;
+      v.data_ = v.inline_data();
+      v.size_ = 0;
+      v.capacity_ = N;
+    } else if constexpr (kRelocateBytes) {
+      // буфер фиксированного размера копируется без цикла
+      std::memcpy(inline_, v.inline_, sizeof(inline_));
+      size_ = v.size_;
+      v.size_ = 0;
+    } else {
+      move_into(v.data_, v.data_ + v.size_, data_);
+      size_ = v.size_;
+      v.clear();
+    }
+  }
+
+  alignas(T) unsigned char inline_[N * sizeof(T)];
+};
+}  // namespace s21
+#endif
@@ -0,0 +1,603 @@
+#ifndef CONTAINERS_SOA_VECTOR_H
+#define CONTAINERS_SOA_VECTOR_H
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "memory.h"
+#include "span.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Столбец soa_vector - непрерывный кусок без владения памятью (s21::span):
+// годится для s21::simd и s21::parallel, его можно резать subspan/first/last.
+template <typename T>
+using soa_column = span<T>;
+
+// Вектор записей, разложенный по столбцам (structure of arrays): каждое
+// поле Ts хранится своим непрерывным массивом, выровненным на kAlignment
+// байт. Цикл по одному полю читает только его байты, а не всю запись, и
+// столбец можно отдать SIMD-ядрам целиком:
+//
+//   s21::soa_vector<float, float, int> points;  // x, y, id
+//   points.push_back({1.f, 2.f, 7});
+//   float sum_x = s21::simd::sum(points.column<0>());
+//
+// Все столбцы лежат в одном блоке памяти и растут вместе: размер и
+// емкость общие. Строка - это прокси std::tuple<Ts &...> на поля в
+// столбцах: по ней можно читать и присваивать (std::get<1>(v[i]) = 5,
+// v[i] = std::make_tuple(...)), а в значение она превращается
+// конструктором std::tuple<Ts...>.
+//
+// Блок берется у Allocator, перепривязанного к std::byte (поля
+// конструируются через тот же аллокатор, перепривязанный к их типам).
+// Аллокатор не обязан выравнивать больше, чем на alignof(std::max_align_t),
+// поэтому блок запрашивается с запасом kAlignment - 1 байт, а столбцы
+// начинаются с первой выровненной границы. Поля идут после аллокатора, так
+// что сам шаблон - basic_soa_vector<Allocator, Ts...>, а soa_vector<Ts...> -
+// его вариант со std::allocator.
+template <typename Allocator, typename... Ts>
+class basic_soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one field");
+
+  using byte_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<std::byte>;
+  using byte_traits = std::allocator_traits<byte_allocator>;
+
+  template <bool Const>
+  class RowIterator;
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  using iterator = RowIterator<false>;
+  using const_iterator = RowIterator<true>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  // Выравнивание начала каждого столбца: строка кэша и AVX-512
+  static constexpr size_type kAlignment =
+      std::max({std::size_t(64), alignof(Ts)...});
+
+  basic_soa_vector() : basic_soa_vector(Allocator()) {}
+
+  explicit basic_soa_vector(const Allocator &alloc) noexcept : alloc_(alloc) {}
+
+  explicit basic_soa_vector(size_type n, const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    resize(n);
+  }
+
+  basic_soa_vector(std::initializer_list<value_type> const &items,
+                   const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    reserve(items.size());
+    for (const value_type &item : items) {
+      push_back(item);
+    }
+  }
+
+  basic_soa_vector(const basic_soa_vector &v)
+      : alloc_(byte_traits::select_on_container_copy_construction(v.alloc_)) {
+    append_copy(v);
+  }
+  basic_soa_vector(const basic_soa_vector &v, const Allocator &alloc)
+      : alloc_(alloc) {
+    append_copy(v);
+  }
+
+  basic_soa_vector(basic_soa_vector &&v) noexcept : alloc_(v.alloc_) {
+    take(v);
+  }
+  basic_soa_vector(basic_soa_vector &&v, const Allocator &alloc)
+      : alloc_(alloc) {
+    *this = std::move(v);
+  }
+
+  ~basic_soa_vector() { release(); }
+
+  basic_soa_vector &operator=(const basic_soa_vector &v) {
+    if (this != &v) {
+      if constexpr (byte_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (alloc_ != v.alloc_) {
+          release();
+        }
+      }
+      clear();
+      alloc_on_copy(alloc_, v.alloc_);
+      append_copy(v);
+    }
+    return *this;
+  }
+
+  basic_soa_vector &operator=(basic_soa_vector &&v) {
+    if (this != &v) {
+      if (alloc_can_steal(alloc_, v.alloc_)) {
+        release();
+        alloc_on_move(alloc_, v.alloc_);
+        take(v);
+      } else {
+        // блок v принадлежит чужому аллокатору, переносим строки
+        clear();
+        reserve(v.size_);
+        for (size_type i = 0; i < v.size_; i++) {
+          emplace_row(v.moved_row(i, kIndices), kIndices);
+        }
+        v.clear();
+      }
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return row(pos, kIndices);
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return row(pos, kIndices);
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "soa_vector index out of range");
+    return row(pos, kIndices);
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "soa_vector index out of range");
+    return row(pos, kIndices);
+  }
+  const_reference front() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return row(0, kIndices);
+  }
+  const_reference back() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return row(size_ - 1, kIndices);
+  }
+
+  // Столбец поля I целиком
+  template <std::size_t I>
+  soa_column<field_type<I>> column() noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+  template <std::size_t I>
+  soa_column<const field_type<I>> column() const noexcept {
+    return {std::get<I>(columns_), size_};
+  }
+
+  template <std::size_t I>
+  field_type<I> *data() noexcept {
+    return std::get<I>(columns_);
+  }
+  template <std::size_t I>
+  const field_type<I> *data() const noexcept {
+    return std::get<I>(columns_);
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<std::size_t>::max() / 2 / kRowBytes;
+  }
+
+  allocator_type get_allocator() const noexcept { return Allocator(alloc_); }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) {
+      relocate(new_capacity);
+    }
+  }
+
+  void shrink_to_fit() {
+    if (capacity_ > size_) {
+      relocate(size_);
+    }
+  }
+
+  void push_back(const value_type &item) {
+    std::apply([this](const Ts &...fields) { emplace_back(fields...); },
+               item);
+  }
+  void push_back(value_type &&item) {
+    std::apply([this](Ts &...fields) { emplace_back(std::move(fields)...); },
+               item);
+  }
+
+  // По одному аргументу конструктора на каждое поле
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Ts),
+                  "one argument per field is expected");
+    if (size_ == capacity_) {
+      // аргументы могут ссылаться на поля этого же вектора
+      value_type item(std::forward<Args>(args)...);
+      relocate(recommend(size_ + 1));
+      emplace_row(std::move(item), kIndices);
+    } else {
+      emplace_row(std::forward_as_tuple(std::forward<Args>(args)...),
+                  kIndices);
+    }
+    return row(size_ - 1, kIndices);
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      size_--;
+      destroy_rows(size_, size_ + 1, kIndices);
+    }
+  }
+
+  void clear() noexcept {
+    destroy_rows(0, size_, kIndices);
+    size_ = 0;
+  }
+
+  void resize(size_type n) {
+    reserve(n);
+    while (size_ < n) {
+      emplace_back(Ts()...);
+    }
+    if (n < size_) {
+      destroy_rows(n, size_, kIndices);
+      size_ = n;
+    }
+  }
+
+  void swap(basic_soa_vector &other) noexcept {
+    alloc_on_swap(alloc_, other.alloc_);
+    std::swap(block_, other.block_);
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  using columns_type = std::tuple<Ts *...>;
+  static constexpr std::index_sequence_for<Ts...> kIndices{};
+  static constexpr size_type kRowBytes = (sizeof(Ts) + ...);
+
+  template <typename F>
+  using field_allocator = typename byte_traits::template rebind_alloc<F>;
+  template <typename F>
+  using field_traits = std::allocator_traits<field_allocator<F>>;
+
+  std::byte *block_ = nullptr;  // начало блока от аллокатора, не выровненное
+  columns_type columns_{};
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+  byte_allocator alloc_;
+
+  static constexpr size_type align_up(size_type bytes) noexcept {
+    return (bytes + kAlignment - 1) / kAlignment * kAlignment;
+  }
+
+  // Байты блока на capacity строк: столбцы подряд, каждый с границы
+  // kAlignment, и запас на выравнивание начала
+  static size_type block_bytes(size_type capacity) noexcept {
+    return (align_up(capacity * sizeof(Ts)) + ...) + kAlignment - 1;
+  }
+
+  template <std::size_t... I>
+  static columns_type layout(std::byte *block, size_type capacity,
+                             std::index_sequence<I...>) noexcept {
+    columns_type columns;
+    size_type offset = (kAlignment - reinterpret_cast<std::uintptr_t>(block) %
+                                         kAlignment) %
+                       kAlignment;
+    ((std::get<I>(columns) = reinterpret_cast<field_type<I> *>(block + offset),
+      offset += align_up(capacity * sizeof(field_type<I>))),
+     ...);
+    return columns;
+  }
+
+  size_type recommend(size_type new_size) const {
+    if (new_size > max_size()) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    size_type grown = capacity_;
+    if (grown <= max_size() / S21_VECTOR_GROWTH_NUM) {
+      grown = grown * S21_VECTOR_GROWTH_NUM / S21_VECTOR_GROWTH_DEN;
+    } else {
+      grown = max_size();
+    }
+    return grown > new_size ? grown : new_size;
+  }
+
+  template <std::size_t... I>
+  reference row(size_type pos, std::index_sequence<I...>) noexcept {
+    return reference(std::get<I>(columns_)[pos]...);
+  }
+  template <std::size_t... I>
+  const_reference row(size_type pos, std::index_sequence<I...>) const noexcept {
+    return const_reference(std::get<I>(columns_)[pos]...);
+  }
+
+  // Строка size_ из полей кортежа fields. Если конструктор поля бросил,
+  // уже созданные поля строки разрушаются.
+  template <typename Tuple, std::size_t... I>
+  void emplace_row(Tuple &&fields, std::index_sequence<I...>) {
+    std::size_t built = 0;
+    try {
+      ((construct_field(std::get<I>(columns_) + size_,
+                        std::get<I>(std::forward<Tuple>(fields))),
+        built++),
+       ...);
+    } catch (...) {
+      ((I < built ? destroy_fields(std::get<I>(columns_) + size_,
+                                   std::get<I>(columns_) + size_ + 1)
+                  : void()),
+       ...);
+      throw;
+    }
+    size_++;
+  }
+
+  // Строка pos как кортеж rvalue-ссылок: для переноса в другой вектор
+  template <std::size_t... I>
+  std::tuple<Ts &&...> moved_row(size_type pos,
+                                 std::index_sequence<I...>) noexcept {
+    return std::tuple<Ts &&...>(std::move(std::get<I>(columns_)[pos])...);
+  }
+
+  template <typename F, typename... Args>
+  void construct_field(F *p, Args &&...args) {
+    field_allocator<F> alloc(alloc_);
+    field_traits<F>::construct(alloc, p, std::forward<Args>(args)...);
+  }
+
+  template <typename F>
+  void destroy_fields(F *first, F *last) noexcept {
+    if constexpr (!std::is_trivially_destructible<F>::value ||
+                  !allocator_constructs_plainly<field_allocator<F>,
+                                                F>::value) {
+      field_allocator<F> alloc(alloc_);
+      for (; first != last; ++first) {
+        field_traits<F>::destroy(alloc, first);
+      }
+    }
+  }
+
+  template <std::size_t... I>
+  void destroy_rows(size_type first, size_type last,
+                    std::index_sequence<I...>) noexcept {
+    (destroy_fields(std::get<I>(columns_) + first,
+                    std::get<I>(columns_) + last),
+     ...);
+  }
+
+  // Переносит столбец I в new_columns. Тривиально переносимые поля
+  // копируются memcpy, остальные перемещаются (копируются, если
+  // перемещение может бросить, ради строгой гарантии).
+  template <std::size_t I>
+  void transfer_column(const columns_type &new_columns) {
+    using F = field_type<I>;
+    F *from = std::get<I>(columns_);
+    F *to = std::get<I>(new_columns);
+    if constexpr (can_relocate_bytes_v<field_allocator<F>, F>) {
+      if (size_ > 0) {
+        std::memcpy(static_cast<void *>(to), from, size_ * sizeof(F));
+      }
+    } else {
+      size_type built = 0;
+      try {
+        for (; built < size_; built++) {
+          construct_field(to + built, std::move_if_noexcept(from[built]));
+        }
+      } catch (...) {
+        destroy_fields(to, to + built);
+        throw;
+      }
+    }
+  }
+
+  template <std::size_t I>
+  void drop_column(const columns_type &columns) noexcept {
+    using F = field_type<I>;
+    if constexpr (!can_relocate_bytes_v<field_allocator<F>, F>) {
+      destroy_fields(std::get<I>(columns), std::get<I>(columns) + size_);
+    }
+  }
+
+  template <std::size_t... I>
+  void transfer(const columns_type &new_columns, std::size_t &done,
+                std::index_sequence<I...>) {
+    ((transfer_column<I>(new_columns), done++), ...);
+  }
+
+  template <std::size_t... I>
+  void drop_columns(const columns_type &columns, std::size_t count,
+                    std::index_sequence<I...>) noexcept {
+    ((I < count ? drop_column<I>(columns) : void()), ...);
+  }
+
+  void free_block(std::byte *block, size_type capacity) noexcept {
+    if (block != nullptr) {
+      byte_traits::deallocate(alloc_, block, block_bytes(capacity));
+    }
+  }
+
+  void relocate(size_type new_capacity) {
+    std::byte *new_block = nullptr;
+    columns_type new_columns{};
+    if (new_capacity > 0) {
+      new_block = byte_traits::allocate(alloc_, block_bytes(new_capacity));
+      new_columns = layout(new_block, new_capacity, kIndices);
+    }
+    std::size_t done = 0;
+    try {
+      transfer(new_columns, done, kIndices);
+    } catch (...) {
+      drop_columns(new_columns, done, kIndices);
+      free_block(new_block, new_capacity);
+      throw;
+    }
+    drop_columns(columns_, sizeof...(Ts), kIndices);
+    free_block(block_, capacity_);
+    block_ = new_block;
+    columns_ = new_columns;
+    capacity_ = new_capacity;
+  }
+
+  void append_copy(const basic_soa_vector &v) {
+    reserve(size_ + v.size_);
+    for (size_type i = 0; i < v.size_; i++) {
+      emplace_row(v[i], kIndices);
+    }
+  }
+
+  // Забирает блок v (аллокатор уже общий)
+  void take(basic_soa_vector &v) noexcept {
+    block_ = v.block_;
+    columns_ = v.columns_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    v.block_ = nullptr;
+    v.columns_ = columns_type{};
+    v.size_ = 0;
+    v.capacity_ = 0;
+  }
+
+  void release() noexcept {
+    clear();
+    free_block(block_, capacity_);
+    block_ = nullptr;
+    columns_ = columns_type{};
+    capacity_ = 0;
+  }
+
+  // Итератор по строкам. Разыменование дает прокси-строку, а не ссылку,
+  // поэтому алгоритмы, которые меняют элементы местами (std::sort),
+  // с ним не работают.
+  template <bool Const>
+  class RowIterator {
+    using owner =
+        std::conditional_t<Const, const basic_soa_vector, basic_soa_vector>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = basic_soa_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference =
+        std::conditional_t<Const, basic_soa_vector::const_reference,
+                           basic_soa_vector::reference>;
+
+    RowIterator() noexcept : vector_(nullptr), pos_(0) {}
+    RowIterator(owner *vector, size_type pos) noexcept
+        : vector_(vector), pos_(pos) {}
+    // iterator -> const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    RowIterator(const RowIterator<false> &other) noexcept
+        : vector_(other.vector_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept { return (*vector_)[pos_]; }
+    reference operator[](difference_type n) const noexcept {
+      return (*vector_)[pos_ + n];
+    }
+
+    RowIterator &operator++() noexcept {
+      pos_++;
+      return *this;
+    }
+    RowIterator operator++(int) noexcept {
+      RowIterator tmp(*this);
+      pos_++;
+      return tmp;
+    }
+    RowIterator &operator--() noexcept {
+      pos_--;
+      return *this;
+    }
+    RowIterator operator--(int) noexcept {
+      RowIterator tmp(*this);
+      pos_--;
+      return tmp;
+    }
+    RowIterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    RowIterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    friend RowIterator operator+(RowIterator it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend RowIterator operator+(difference_type n, RowIterator it) noexcept {
+      return it += n;
+    }
+    friend RowIterator operator-(RowIterator it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const RowIterator &a,
+                                     const RowIterator &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+
+    bool operator==(const RowIterator &other) const noexcept {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const RowIterator &other) const noexcept {
+      return pos_ != other.pos_;
+    }
+    bool operator<(const RowIterator &other) const noexcept {
+      return pos_ < other.pos_;
+    }
+    bool operator>(const RowIterator &other) const noexcept {
+      return pos_ > other.pos_;
+    }
+    bool operator<=(const RowIterator &other) const noexcept {
+      return pos_ <= other.pos_;
+    }
+    bool operator>=(const RowIterator &other) const noexcept {
+      return pos_ >= other.pos_;
+    }
+
+   private:
+    friend class RowIterator<!Const>;
+
+    owner *vector_;
+    size_type pos_;
+  };
+};
+
+template <typename... Ts>
+using soa_vector = basic_soa_vector<std::allocator<std::byte>, Ts...>;
+
+}  // namespace s21
+
+#endif  // CONTAINERS_SOA_VECTOR_H
@@ -0,0 +1,352 @@
+#ifndef CONTAINERS_SPAN_H
+#define CONTAINERS_SPAN_H
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../containersplus/array.h"
+#include "hardening.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Длина "до конца" для subspan
+inline constexpr std::size_t dynamic_extent =
+    std::numeric_limits<std::size_t>::max();
+
+namespace detail {
+// U* можно отдать как T* (T - это U или const U)
+template <typename U, typename T>
+using enable_if_view_of =
+    std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>;
+}  // namespace detail
+
+// Непрерывный кусок чужих элементов: указатель и длина, без владения.
+// Передача подотрезка вектора в функцию через span ничего не копирует.
+// span годится везде, где нужны value_type, data() и size(), то есть для
+// s21::simd и s21::parallel, а итераторы - обычные указатели:
+//
+//   s21::vector<float> v = ...;
+//   float tail = s21::simd::sum(s21::span(v).subspan(1000));
+//   s21::parallel::sort(s21::span(v).first(100));
+//
+// span не продлевает жизнь элементов: после роста или уничтожения вектора
+// он становится недействительным, как и итераторы вектора.
+template <typename T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using pointer = T *;
+  using iterator = T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr span() noexcept : data_(nullptr), size_(0) {}
+  constexpr span(T *data, size_type size) noexcept
+      : data_(data), size_(size) {}
+  constexpr span(T *first, T *last) noexcept
+      : data_(first), size_(static_cast<size_type>(last - first)) {}
+  template <std::size_t N>
+  constexpr span(T (&items)[N]) noexcept : data_(items), size_(N) {}
+
+  template <typename U, typename Allocator,
+            typename = detail::enable_if_view_of<U, T>>
+  span(vector<U, Allocator> &v) noexcept : data_(v.data()), size_(v.size()) {}
+  template <typename U, typename Allocator,
+            typename = detail::enable_if_view_of<const U, T>>
+  span(const vector<U, Allocator> &v) noexcept
+      : data_(v.data()), size_(v.size()) {}
+
+  template <typename U, std::size_t N,
+            typename = detail::enable_if_view_of<U, T>>
+  span(array<U, N> &a) noexcept : data_(a.data()), size_(N) {}
+  template <typename U, std::size_t N,
+            typename = detail::enable_if_view_of<const U, T>>
+  span(const array<U, N> &a) noexcept : data_(a.data()), size_(N) {}
+
+  // span<T> -> span<const T>
+  template <typename U, typename = detail::enable_if_view_of<U, T>>
+  constexpr span(const span<U> &other) noexcept
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr T *data() const noexcept { return data_; }
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type size_bytes() const noexcept { return size_ * sizeof(T); }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size_; }
+  reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return data_[pos];
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "span index out of range");
+    return data_[pos];
+  }
+  reference front() const noexcept {
+    S21_HARDENING_ASSERT(size_ > 0, "span index out of range");
+    return data_[0];
+  }
+  reference back() const noexcept {
+    S21_HARDENING_ASSERT(size_ > 0, "span index out of range");
+    return data_[size_ - 1];
+  }
+
+  // Первые и последние count элементов
+  span first(size_type count) const {
+    check_range(0, count);
+    return span(data_, count);
+  }
+  span last(size_type count) const {
+    check_range(0, count);
+    return span(data_ + (size_ - count), count);
+  }
+
+  // count элементов с offset; dynamic_extent - до конца
+  span subspan(size_type offset, size_type count = dynamic_extent) const {
+    if (count == dynamic_extent) {
+      check_range(offset, 0);
+      count = size_ - offset;
+    }
+    check_range(offset, count);
+    return span(data_ + offset, count);
+  }
+
+ private:
+  T *data_;
+  size_type size_;
+
+  void check_range(size_type offset, size_type count) const {
+    if (offset > size_ || count > size_ - offset) {
+      throw std::out_of_range("You stepped out of range");
+    }
+  }
+};
+
+template <typename T, std::size_t N>
+span(T (&)[N]) -> span<T>;
+template <typename T, typename Allocator>
+span(vector<T, Allocator> &) -> span<T>;
+template <typename T, typename Allocator>
+span(const vector<T, Allocator> &) -> span<const T>;
+template <typename T, std::size_t N>
+span(array<T, N> &) -> span<T>;
+template <typename T, std::size_t N>
+span(const array<T, N> &) -> span<const T>;
+
+// Каждый stride-й элемент непрерывного куска: столбец матрицы, хранимой по
+// строкам, одна дорожка чередующихся каналов и т.п. Элементы не лежат
+// подряд, поэтому data() нет и s21::simd/s21::parallel вид не принимают;
+// итераторы произвольного доступа подходят для алгоритмов STL:
+//
+//   s21::vector<float> matrix(rows * cols);
+//   s21::strided_view<float> column{s21::span(matrix).subspan(j), cols};
+//   std::sort(column.begin(), column.end());
+template <typename T>
+class strided_view {
+  class StrideIterator;
+
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using pointer = T *;
+  using iterator = StrideIterator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  strided_view() noexcept : data_(nullptr), size_(0), stride_(1) {}
+
+  // size элементов: data[0], data[stride], ..., data[(size - 1) * stride]
+  strided_view(T *data, size_type size, size_type stride)
+      : data_(data), size_(size), stride_(checked_stride(stride)) {}
+
+  // Элементы items с номерами 0, stride, 2 * stride, ...
+  strided_view(span<T> items, size_type stride)
+      : data_(items.data()),
+        size_((items.size() + checked_stride(stride) - 1) / stride),
+        stride_(stride) {}
+
+  template <typename U, typename = detail::enable_if_view_of<U, T>>
+  strided_view(const strided_view<U> &other) noexcept
+      : data_(other.base()), size_(other.size()), stride_(other.stride()) {}
+
+  // Указатель на первый элемент
+  T *base() const noexcept { return data_; }
+  size_type size() const noexcept { return size_; }
+  size_type stride() const noexcept { return stride_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  iterator begin() const noexcept { return iterator(data_, stride_, 0); }
+  iterator end() const noexcept { return iterator(data_, stride_, size_); }
+
+  reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position out of range");
+    }
+    return data_[pos * stride_];
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "strided_view index out of range");
+    return data_[pos * stride_];
+  }
+  reference front() const noexcept { return (*this)[0]; }
+  reference back() const noexcept { return (*this)[size_ - 1]; }
+
+  strided_view first(size_type count) const {
+    check_range(0, count);
+    return strided_view(data_, count, stride_);
+  }
+  strided_view last(size_type count) const {
+    check_range(0, count);
+    return strided_view(data_ + (size_ - count) * stride_, count, stride_);
+  }
+  strided_view subspan(size_type offset,
+                       size_type count = dynamic_extent) const {
+    if (count == dynamic_extent) {
+      check_range(offset, 0);
+      count = size_ - offset;
+    }
+    check_range(offset, count);
+    return strided_view(data_ + offset * stride_, count, stride_);
+  }
+
+ private:
+  T *data_;
+  size_type size_;
+  size_type stride_;
+
+  static size_type checked_stride(size_type stride) {
+    if (stride == 0) {
+      throw std::invalid_argument("strided_view: stride must be positive");
+    }
+    return stride;
+  }
+
+  void check_range(size_type offset, size_type count) const {
+    if (offset > size_ || count > size_ - offset) {
+      throw std::out_of_range("You stepped out of range");
+    }
+  }
+
+  // Итератор хранит начало, шаг и номер элемента, а не сдвинутый указатель:
+  // end() не выходит за пределы памяти, на которую указывает вид.
+  class StrideIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    StrideIterator() noexcept : data_(nullptr), stride_(1), pos_(0) {}
+    StrideIterator(T *data, size_type stride, size_type pos) noexcept
+        : data_(data), stride_(stride), pos_(pos) {}
+
+    reference operator*() const noexcept { return data_[pos_ * stride_]; }
+    pointer operator->() const noexcept { return &**this; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    StrideIterator &operator++() noexcept {
+      pos_++;
+      return *this;
+    }
+    StrideIterator operator++(int) noexcept {
+      StrideIterator tmp(*this);
+      pos_++;
+      return tmp;
+    }
+    StrideIterator &operator--() noexcept {
+      pos_--;
+      return *this;
+    }
+    StrideIterator operator--(int) noexcept {
+      StrideIterator tmp(*this);
+      pos_--;
+      return tmp;
+    }
+    StrideIterator &operator+=(difference_type n) noexcept {
+      pos_ += n;
+      return *this;
+    }
+    StrideIterator &operator-=(difference_type n) noexcept {
+      pos_ -= n;
+      return *this;
+    }
+    friend StrideIterator operator+(StrideIterator it,
+                                    difference_type n) noexcept {
+      return it += n;
+    }
+    friend StrideIterator operator+(difference_type n,
+                                    StrideIterator it) noexcept {
+      return it += n;
+    }
+    friend StrideIterator operator-(StrideIterator it,
+                                    difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const StrideIterator &a,
+                                     const StrideIterator &b) noexcept {
+      return static_cast<difference_type>(a.pos_) -
+             static_cast<difference_type>(b.pos_);
+    }
+
+    bool operator==(const StrideIterator &other) const noexcept {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const StrideIterator &other) const noexcept {
+      return pos_ != other.pos_;
+    }
+    bool operator<(const StrideIterator &other) const noexcept {
+      return pos_ < other.pos_;
+    }
+    bool operator>(const StrideIterator &other) const noexcept {
+      return pos_ > other.pos_;
+    }
+    bool operator<=(const StrideIterator &other) const noexcept {
+      return pos_ <= other.pos_;
+    }
+    bool operator>=(const StrideIterator &other) const noexcept {
+      return pos_ >= other.pos_;
+    }
+
+   private:
+    T *data_;
+    size_type stride_;
+    size_type pos_;
+  };
+};
+
+template <typename T, typename Allocator>
+strided_view(vector<T, Allocator> &, std::size_t) -> strided_view<T>;
+template <typename T, typename Allocator>
+strided_view(const vector<T, Allocator> &, std::size_t)
+    -> strided_view<const T>;
+template <typename T, std::size_t N>
+strided_view(array<T, N> &, std::size_t) -> strided_view<T>;
+template <typename T, std::size_t N>
+strided_view(const array<T, N> &, std::size_t) -> strided_view<const T>;
+template <typename T>
+strided_view(span<T>, std::size_t) -> strided_view<T>;
+
+}  // namespace s21
+
+#endif  // CONTAINERS_SPAN_H
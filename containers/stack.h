@@ -1,93 +1,79 @@
 #ifndef CONTAINERS_STACK_H
 #define CONTAINERS_STACK_H
 
-#include "../containers.h"
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+#include "hardening.h"
+#include "vector.h"
 
 namespace s21 {
-template <typename T>
+// Стек - адаптер над s21::vector, как std::stack над std::vector: вершина -
+// последний элемент вектора. Буфер растет геометрически (множитель
+// S21_VECTOR_GROWTH_NUM / S21_VECTOR_GROWTH_DEN), поэтому push стоит
+// амортизированно O(1), а pop не освобождает память.
+template <typename T, typename Allocator = std::allocator<T>>
 class stack {
  public:
+  using container_type = vector<T, Allocator>;
   using value_type = T;
-  using reference = T &;
-  using const_reference = const T &;
+  using allocator_type = Allocator;
+  // у упакованного vector<bool> ссылки - прокси на бит
+  using reference = typename container_type::reference;
+  using const_reference = typename container_type::const_reference;
   using size_type = size_t;
 
-  stack() : data_(nullptr), size_(0) {}
+  stack() : stack(Allocator()) {}
 
-  stack(std::initializer_list<value_type> const &items) : stack() {  //  - NT
-    size_ = items.size();
-    data_ = new value_type[size_];
-    std::copy(items.begin(), items.end(), data_);
-  }
+  explicit stack(const Allocator &alloc) : c_(alloc) {}
 
-  // copy constructor - NT
-  stack(const stack &s) : stack() {
-    size_ = s.size_;
-    data_ = new value_type[size_];
-    for (size_type i = 0; i < size_; i++) {
-      data_[i] = s.data_[i];
-    }
-  }
-  // move constructor - NT
-  stack(stack &&s) : stack() { *this = std::move(s); }
-
-  // destructor
-  ~stack() {
-    delete[] data_;
-    size_ = 0;
-    data_ = nullptr;
-  }
-  //
-  // overload for moving - NT
-  stack &operator=(stack &&s) {
-    if (this != &s) {
-      delete[] data_;
-      size_ = s.size_;
-      data_ = s.data_;
-      s.size_ = 0;
-      s.data_ = nullptr;
-    }
-    return *this;
-  }
-  /////////////////////////////////////////////////////
+  stack(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator())
+      : c_(items, alloc) {}
+
+  stack(const stack &s) = default;
+  stack(const stack &s, const Allocator &alloc) : c_(s.c_, alloc) {}
+  stack(stack &&s) = default;
+  stack(stack &&s, const Allocator &alloc) : c_(std::move(s.c_), alloc) {}
+  ~stack() = default;
 
-  const_reference top() noexcept {
-    // мб надо вкинуть исключение
-    return data_[size_ - 1];
+  stack &operator=(stack &&s) = default;
+  stack &operator=(const stack &s) = default;
+
+  // Без проверки на пустоту, проверяет сборка с S21_HARDENED
+  reference top() noexcept {
+    S21_HARDENING_ASSERT(!empty(), "stack is empty");
+    return c_[c_.size() - 1];
   }
-  bool empty() noexcept {
-    bool empty = true;
-    if (size_ > 0) {
-      empty = false;
-    }
-    return empty;
+  const_reference top() const noexcept {
+    S21_HARDENING_ASSERT(!empty(), "stack is empty");
+    return c_[c_.size() - 1];
   }
+  bool empty() const noexcept { return c_.size() == 0; }
+  size_type size() const noexcept { return c_.size(); }
+  size_type capacity() const noexcept { return c_.capacity(); }
 
-  size_type size() noexcept { return size_; }
+  // Выделяет место под n элементов заранее, дальше push не аллоцирует
+  void reserve(size_type n) { c_.reserve(n); }
 
-  void push(const_reference value) {
-    value_type *tempStack = data_;
-    data_ = new value_type[size_ + 1];
-    std::copy(tempStack, tempStack + size_, data_);
-    delete[] tempStack;
-    data_[size_] = value;
-    size_++;
-  }
+  allocator_type get_allocator() const noexcept { return c_.get_allocator(); }
 
-  void pop() {
-    if (size_ != 0) {
-      size_--;
-    }
-  }
+  void push(const value_type &value) { c_.push_back(value); }
+  void push(value_type &&value) { c_.push_back(std::move(value)); }
 
-  void swap(stack &other) {
-    std::swap(size_, other.size_);
-    std::swap(data_, other.data_);
+  // Создает элемент на вершине из аргументов конструктора T
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return c_.emplace_back(std::forward<Args>(args)...);
   }
 
+  void pop() { c_.pop_back(); }
+
+  void swap(stack &other) { c_.swap(other.c_); }
+
  private:
-  T *data_;
-  size_type size_;
+  container_type c_;
 };
 }  // namespace s21
 #endif
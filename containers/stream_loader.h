@@ -0,0 +1,358 @@
+#ifndef CONTAINERS_STREAM_LOADER_H
+#define CONTAINERS_STREAM_LOADER_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "vector.h"
+
+// Потоковая загрузка больших файлов в контейнеры s21. Файл читается
+// блоками фиксированного размера (read() в один и тот же буфер или
+// скользящее окно mmap), записи разбираются по мере чтения и пачками
+// вставляются в контейнер. Пиковая память - это сам контейнер плюс буфер
+// чтения, пачка записей и остаток строки или записи на стыке блоков;
+// от размера файла она не зависит.
+//
+//   s21::map<std::int64_t, double> prices;
+//   s21::load_lines("prices.csv", prices,
+//                   [](std::string_view line)
+//                       -> std::optional<std::pair<std::int64_t, double>> {
+//                     ...  // пустой optional пропускает строку
+//                   });
+//
+//   s21::vector<Tick> ticks;
+//   s21::load_records<Tick>("ticks.bin", ticks);
+//
+// Ошибки открытия и чтения файла бросают std::system_error, обрезанная
+// последняя двоичная запись - std::runtime_error. Исключение из разборщика
+// прерывает загрузку; уже вставленные записи остаются в контейнере.
+
+namespace s21 {
+
+struct stream_options {
+  // Размер буфера чтения или окна mmap (округляется до страницы)
+  std::size_t buffer_bytes = std::size_t(1) << 20;
+  // Сколько записей копится перед вставкой в контейнер
+  std::size_t batch_size = 4096;
+  // Читать окнами mmap вместо read(): без копирования в буфер, страницы
+  // прошлого окна отдаются через munmap
+  bool use_mmap = false;
+};
+
+// Файл, прочитанный последовательными блоками. next() возвращает следующий
+// блок, пустой в конце файла; блок действителен до следующего вызова.
+class file_chunks {
+ public:
+  file_chunks(const std::string &path, const stream_options &options)
+      : use_mmap_(options.use_mmap) {
+    fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+      throw_errno("open " + path);
+    }
+    std::size_t bytes = std::max<std::size_t>(options.buffer_bytes, 1);
+    if (use_mmap_) {
+      struct stat st;
+      if (::fstat(fd_, &st) != 0) {
+        int error = errno;
+        ::close(fd_);
+        throw std::system_error(error, std::generic_category(),
+                                "stream_loader: fstat " + path);
+      }
+      file_size_ = static_cast<std::size_t>(st.st_size);
+      std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+      window_bytes_ = (bytes + page - 1) / page * page;
+    } else {
+#ifdef POSIX_FADV_SEQUENTIAL
+      // подсказка ядру читать вперед крупнее
+      ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+      try {
+        buffer_.resize(bytes);
+      } catch (...) {
+        ::close(fd_);
+        throw;
+      }
+    }
+  }
+
+  file_chunks(const file_chunks &) = delete;
+  file_chunks &operator=(const file_chunks &) = delete;
+
+  ~file_chunks() {
+    unmap();
+    ::close(fd_);
+  }
+
+  std::string_view next() {
+    return use_mmap_ ? next_window() : next_buffer();
+  }
+
+ private:
+  int fd_ = -1;
+  bool use_mmap_;
+  vector<char> buffer_;
+  std::size_t file_size_ = 0;
+  std::size_t window_bytes_ = 0;
+  std::size_t offset_ = 0;
+  void *window_ = nullptr;
+  std::size_t mapped_ = 0;
+
+  [[noreturn]] static void throw_errno(const std::string &what) {
+    throw std::system_error(errno, std::generic_category(),
+                            "stream_loader: " + what);
+  }
+
+  std::string_view next_buffer() {
+    for (;;) {
+      ssize_t got = ::read(fd_, buffer_.data(), buffer_.size());
+      if (got >= 0) {
+        return std::string_view(buffer_.data(), static_cast<std::size_t>(got));
+      }
+      if (errno != EINTR) {
+        throw_errno("read");
+      }
+    }
+  }
+
+  std::string_view next_window() {
+    unmap();
+    if (offset_ >= file_size_) {
+      return std::string_view();
+    }
+    std::size_t bytes = std::min(window_bytes_, file_size_ - offset_);
+    window_ = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd_,
+                     static_cast<off_t>(offset_));
+    if (window_ == MAP_FAILED) {
+      window_ = nullptr;
+      throw_errno("mmap");
+    }
+    mapped_ = bytes;
+    ::madvise(window_, bytes, MADV_SEQUENTIAL);
+    offset_ += bytes;
+    return std::string_view(static_cast<const char *>(window_), bytes);
+  }
+
+  void unmap() noexcept {
+    if (window_) {
+      ::munmap(window_, mapped_);
+      window_ = nullptr;
+    }
+  }
+};
+
+namespace detail {
+
+template <typename Container, typename = void>
+struct has_push_back : std::false_type {};
+template <typename Container>
+struct has_push_back<Container,
+                     std::void_t<decltype(std::declval<Container &>().push_back(
+                         std::declval<typename Container::value_type>()))>>
+    : std::true_type {};
+
+// s21::vector принимает пачку одной вставкой диапазона
+template <typename T, typename Allocator, typename Batch>
+void insert_batch(vector<T, Allocator> &c, Batch &batch) {
+  c.insert(c.end(), std::make_move_iterator(batch.begin()),
+           std::make_move_iterator(batch.end()));
+}
+
+template <typename Container, typename Batch>
+void insert_batch(Container &c, Batch &batch) {
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    if constexpr (has_push_back<Container>::value) {
+      c.push_back(std::move(batch[i]));
+    } else {
+      c.insert(std::move(batch[i]));
+    }
+  }
+}
+
+}  // namespace detail
+
+// Копит записи и вставляет их в контейнер пачками по batch_size. Остаток
+// пачки вставляет только явный flush(): при ошибке разбора недособранная
+// пачка отбрасывается.
+template <typename Container, typename Record>
+class batch_inserter {
+ public:
+  batch_inserter(Container &container, std::size_t batch_size)
+      : container_(container), batch_size_(std::max<std::size_t>(batch_size, 1)) {
+    batch_.reserve(batch_size_);
+  }
+
+  batch_inserter(const batch_inserter &) = delete;
+  batch_inserter &operator=(const batch_inserter &) = delete;
+
+  void add(Record &&record) {
+    batch_.push_back(std::move(record));
+    if (batch_.size() == batch_size_) {
+      flush();
+    }
+  }
+
+  void flush() {
+    detail::insert_batch(container_, batch_);
+    batch_.clear();
+  }
+
+  std::size_t pending() const noexcept { return batch_.size(); }
+
+ private:
+  Container &container_;
+  std::size_t batch_size_;
+  vector<Record> batch_;
+};
+
+// Вызывает f(std::string_view) для каждой строки файла без '\n' и '\r' в
+// конце. Строка, разрезанная границей блока, собирается в отдельном буфере,
+// поэтому он растет только до длины самой длинной такой строки.
+template <typename F>
+void for_each_line(const std::string &path, F f,
+                   const stream_options &options = stream_options()) {
+  auto emit = [&f](const char *first, const char *last) {
+    if (last != first && last[-1] == '\r') {
+      last--;
+    }
+    f(std::string_view(first, static_cast<std::size_t>(last - first)));
+  };
+  file_chunks chunks(path, options);
+  vector<char> carry;
+  for (std::string_view chunk = chunks.next(); !chunk.empty();
+       chunk = chunks.next()) {
+    const char *p = chunk.data();
+    const char *end = p + chunk.size();
+    while (p != end) {
+      const char *newline = static_cast<const char *>(
+          std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+      if (!newline) {
+        carry.insert(carry.end(), p, end);
+        break;
+      }
+      if (carry.empty()) {
+        emit(p, newline);
+      } else {
+        carry.insert(carry.end(), p, newline);
+        emit(carry.data(), carry.data() + carry.size());
+        carry.clear();
+      }
+      p = newline + 1;
+    }
+  }
+  if (!carry.empty()) {
+    emit(carry.data(), carry.data() + carry.size());
+  }
+}
+
+// Вызывает f(const Record &) для каждой двоичной записи файла. Записи
+// копируются из блока через memcpy, поэтому выравнивание блока не важно.
+template <typename Record, typename F>
+void for_each_record(const std::string &path, F f,
+                     const stream_options &options = stream_options()) {
+  static_assert(std::is_trivially_copyable<Record>::value,
+                "records are read as raw bytes");
+  file_chunks chunks(path, options);
+  alignas(Record) char carry[sizeof(Record)];
+  std::size_t carried = 0;
+  Record record;
+  for (std::string_view chunk = chunks.next(); !chunk.empty();
+       chunk = chunks.next()) {
+    const char *p = chunk.data();
+    std::size_t left = chunk.size();
+    if (carried > 0) {
+      std::size_t take = std::min(sizeof(Record) - carried, left);
+      std::memcpy(carry + carried, p, take);
+      carried += take;
+      p += take;
+      left -= take;
+      if (carried < sizeof(Record)) {
+        continue;
+      }
+      std::memcpy(&record, carry, sizeof(Record));
+      f(static_cast<const Record &>(record));
+      carried = 0;
+    }
+    for (; left >= sizeof(Record); p += sizeof(Record), left -= sizeof(Record)) {
+      std::memcpy(&record, p, sizeof(Record));
+      f(static_cast<const Record &>(record));
+    }
+    std::memcpy(carry, p, left);
+    carried = left;
+  }
+  if (carried > 0) {
+    throw std::runtime_error("stream_loader: " + path +
+                             " ends with a truncated record");
+  }
+}
+
+// Загружает строки файла в контейнер: parse(std::string_view) возвращает
+// std::optional<Record>, пустой optional пропускает строку (заголовок CSV,
+// комментарий). Record вставляется через push_back или insert. Возвращает
+// число вставленных записей.
+template <typename Container, typename Parse>
+std::size_t load_lines(const std::string &path, Container &container,
+                       Parse parse,
+                       const stream_options &options = stream_options()) {
+  using parsed = std::invoke_result_t<Parse &, std::string_view>;
+  using record_type = typename parsed::value_type;
+  batch_inserter<Container, record_type> batch(container, options.batch_size);
+  std::size_t count = 0;
+  for_each_line(
+      path,
+      [&](std::string_view line) {
+        parsed record = parse(line);
+        if (record) {
+          batch.add(std::move(*record));
+          count++;
+        }
+      },
+      options);
+  batch.flush();
+  return count;
+}
+
+// Загружает двоичные записи Record, каждую через convert(const Record &)
+template <typename Record, typename Container, typename Convert>
+std::size_t load_records(const std::string &path, Container &container,
+                         Convert convert,
+                         const stream_options &options = stream_options()) {
+  using converted = std::decay_t<std::invoke_result_t<Convert &, const Record &>>;
+  batch_inserter<Container, converted> batch(container, options.batch_size);
+  std::size_t count = 0;
+  for_each_record<Record>(
+      path,
+      [&](const Record &record) {
+        batch.add(convert(record));
+        count++;
+      },
+      options);
+  batch.flush();
+  return count;
+}
+
+// Загружает двоичные записи Record в контейнер как есть
+template <typename Record, typename Container>
+std::size_t load_records(const std::string &path, Container &container,
+                         const stream_options &options = stream_options()) {
+  return load_records<Record>(
+      path, container, [](const Record &record) { return record; }, options);
+}
+
+}  // namespace s21
+
+#endif  // CONTAINERS_STREAM_LOADER_H
@@ -0,0 +1,555 @@
+#ifndef CONTAINERS_VECTOR_BASE_H
+#define CONTAINERS_VECTOR_BASE_H
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "hardening.h"
+#include "memory.h"
+
+// Во сколько раз растет емкость вектора, когда место закончилось:
+// S21_VECTOR_GROWTH_NUM / S21_VECTOR_GROWTH_DEN. По умолчанию 2, для
+// экономии памяти можно собрать с -DS21_VECTOR_GROWTH_NUM=3
+// -DS21_VECTOR_GROWTH_DEN=2. Любой множитель больше 1 дает амортизированное
+// O(1) на добавление.
+#ifndef S21_VECTOR_GROWTH_NUM
+#define S21_VECTOR_GROWTH_NUM 2
+#endif
+#ifndef S21_VECTOR_GROWTH_DEN
+#define S21_VECTOR_GROWTH_DEN 1
+#endif
+
+namespace s21 {
+namespace detail {
+
+// Общая часть s21::vector и s21::small_vector: непрерывный буфер
+// [data_, data_ + capacity_), в котором живы первые size_ элементов, рост,
+// перенос элементов и весь интерфейс доступа и изменения.
+//
+// Откуда берется буфер, решает Derived (CRTP) через три метода:
+//   T *allocate(size_type n)             - новый буфер на n ячеек, не
+//                                          текущий
+//   void deallocate(T *p, size_type n)   - вернуть буфер из allocate
+//   bool can_reallocate(size_type n)     - можно ли растить текущий буфер
+//                                          через alloc_.reallocate
+// Конструкторы, присваивание, swap, деструктор и shrink_to_fit тоже у
+// Derived: у вектора с внутренним буфером они устроены иначе.
+template <typename Derived, typename T, typename Allocator>
+class vector_base {
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  vector_base(const vector_base &) = delete;
+  vector_base &operator=(const vector_base &) = delete;
+
+  reference at(size_type pos) {
+    if (pos < size_) {
+      return data_[pos];
+    } else {
+      throw std::out_of_range("Position out of range");
+    }
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "vector index out of range");
+    return data_[pos];
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < size_, "vector index out of range");
+    return data_[pos];
+  }
+  const_reference front() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return data_[0];
+  }
+  const_reference back() const {
+    if (!size_) {
+      throw std::out_of_range("Vector is empty");
+    }
+    return data_[size_ - 1];
+  }
+
+  iterator data() noexcept { return data_; }
+  const_iterator data() const noexcept { return data_; }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  iterator begin() { return data_; }
+  iterator end() { return data_ + size_; }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return capacity_; }
+  size_type max_size() const {
+    return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+  }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) {
+      relocate(new_capacity);
+    }
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      size_--;
+      alloc_traits::destroy(alloc_, data_ + size_);
+    }
+  }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  // Создает элемент прямо в конце вектора из аргументов конструктора T
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    // если места нет, элемент создается сразу в новом буфере (args могут
+    // ссылаться на элементы этого же вектора)
+    if (capacity_ == size_) {
+      realloc_append(std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(alloc_, data_ + size_,
+                              std::forward<Args>(args)...);
+      size_++;
+    }
+    return data_[size_ - 1];
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // Вставляет n копий value, хвост сдвигается один раз на все n
+  iterator insert(iterator pos, size_type n, const_reference value) {
+    size_type offset = insert_offset(pos);
+    if (n > 0 && owns(value)) {
+      // value лежит в хвосте, который сейчас сдвинется
+      value_type copy(value);
+      return insert(pos, n, copy);
+    }
+    return insert_with(offset, n, [this, &value](T *slot, size_type) {
+      alloc_traits::construct(alloc_, slot, value);
+    });
+  }
+
+  // Вставляет [first, last) одним сдвигом. Диапазон не должен указывать
+  // внутрь этого же вектора.
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  iterator insert(iterator pos, InputIt first, InputIt last) {
+    size_type offset = insert_offset(pos);
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      InputIt>::iterator_category>::value) {
+      size_type count = std::distance(first, last);
+      return insert_with(offset, count, [this, &first](T *slot, size_type) {
+        alloc_traits::construct(alloc_, slot, *first);
+        ++first;
+      });
+    } else {
+      // длину однопроходного диапазона заранее не узнать, собираем его
+      // отдельно и вставляем целиком
+      Derived items(alloc_);
+      for (; first != last; ++first) {
+        items.emplace_back(*first);
+      }
+      return insert(pos, std::make_move_iterator(items.begin()),
+                    std::make_move_iterator(items.end()));
+    }
+  }
+
+  iterator insert(iterator pos, std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  // Создает элемент перед pos из аргументов конструктора T
+  template <typename... Args>
+  iterator emplace(iterator pos, Args &&...args) {
+    size_type offset = insert_offset(pos);
+    if (offset == size_ || size_ == capacity_) {
+      // элемент создается раньше, чем сдвинутся старые, так что args могут
+      // ссылаться на элементы вектора
+      return insert_with(offset, 1, [&](T *slot, size_type) {
+        alloc_traits::construct(alloc_, slot, std::forward<Args>(args)...);
+      });
+    }
+    value_type value(std::forward<Args>(args)...);
+    return insert_with(offset, 1, [this, &value](T *slot, size_type) {
+      alloc_traits::construct(alloc_, slot, std::move(value));
+    });
+  }
+
+  // Вставляет перед pos по элементу на каждый аргумент
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    size_type offset = insert_offset(pos);
+    if constexpr (sizeof...(Args) == 0) {
+      return data_ + offset;
+    } else {
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      return insert(data_ + offset, std::make_move_iterator(std::begin(items)),
+                    std::make_move_iterator(std::end(items)));
+    }
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+  }
+
+  iterator erase(iterator pos) {
+    size_type diff = pos - begin();
+    if (diff >= size_) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    return erase(pos, pos + 1);
+  }
+
+  // Удаляет [first, last), хвост сдвигается один раз
+  iterator erase(iterator first, iterator last) {
+    size_type offset = first - begin();
+    size_type stop = last - begin();
+    if (offset > stop || stop > size_) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    if (offset == stop) {
+      return first;
+    }
+    if constexpr (kRelocateBytes) {
+      destroy(first, last);
+      std::memmove(static_cast<void *>(first), static_cast<void *>(last),
+                   (end() - last) * sizeof(value_type));
+    } else {
+      T *new_end = std::move(last, end(), first);
+      destroy(new_end, end());
+    }
+    size_ -= stop - offset;
+    return data_ + offset;
+  }
+
+  void clear() noexcept {
+    destroy(data_, data_ + size_);
+    size_ = 0;
+  }
+
+  void assign(size_type n, const_reference value) {
+    if (owns(value)) {
+      value_type copy(value);
+      assign(n, copy);
+      return;
+    }
+    clear();
+    reserve(n);
+    insert_with(0, n, [this, &value](T *slot, size_type) {
+      alloc_traits::construct(alloc_, slot, value);
+    });
+  }
+
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      InputIt>::iterator_category>::value) {
+      reserve(std::distance(first, last));
+    }
+    insert(begin(), first, last);
+  }
+
+  void assign(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+  }
+
+  void resize(size_type n) {
+    if (n < size_) {
+      destroy(data_ + n, data_ + size_);
+      size_ = n;
+    } else {
+      insert_with(size_, n - size_, [this](T *slot, size_type) {
+        alloc_traits::construct(alloc_, slot);
+      });
+    }
+  }
+
+  void resize(size_type n, const_reference value) {
+    if (n < size_) {
+      destroy(data_ + n, data_ + size_);
+      size_ = n;
+    } else {
+      // при дописывании в конец хвост не двигается, а в новый буфер
+      // элементы переезжают после создания новых, поэтому value может быть
+      // элементом самого вектора
+      insert_with(size_, n - size_, [this, &value](T *slot, size_type) {
+        alloc_traits::construct(alloc_, slot, value);
+      });
+    }
+  }
+
+ protected:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  // Элементы переносятся memcpy/memmove, а не конструктором перемещения.
+  // Перенесенный объект считается "уехавшим": деструктор для старого места
+  // не вызывается.
+  static constexpr bool kRelocateBytes = can_relocate_bytes_v<Allocator, T>;
+  // Буфер растет через realloc аллокатора (см. malloc_allocator)
+  static constexpr bool kReallocate =
+      kRelocateBytes && allocator_can_reallocate<Allocator>::value;
+
+  // Хвост можно сдвигать внутри буфера: перенос не бросает исключений, и
+  // при ошибке дыру всегда можно закрыть обратно. Для типов с бросающим
+  // перемещением вставка идет через новый буфер ради строгой гарантии.
+  static constexpr bool kShiftInPlace =
+      kRelocateBytes || std::is_nothrow_move_constructible<T>::value;
+
+  vector_base(T *data, size_type capacity, const Allocator &alloc)
+      : data_(data), size_(0), capacity_(capacity), alloc_(alloc) {}
+  ~vector_base() = default;
+
+  Derived &self() noexcept { return static_cast<Derived &>(*this); }
+
+  size_type insert_offset(const_iterator pos) const {
+    size_type offset = pos - data_;
+    if (offset > size_) {
+      throw std::out_of_range("You stepped out of range");
+    }
+    return offset;
+  }
+
+  // true, если value - элемент этого вектора
+  bool owns(const_reference value) const noexcept {
+    const T *p = std::addressof(value);
+    return std::less_equal<const T *>()(data_, p) &&
+           std::less<const T *>()(p, data_ + size_);
+  }
+
+  // Сдвигает [offset, size_) на count ячеек вправо, на их месте остается
+  // сырая дыра. Емкости должно хватать.
+  void shift_tail(size_type offset, size_type count) noexcept {
+    T *first = data_ + offset;
+    if constexpr (kRelocateBytes) {
+      std::memmove(static_cast<void *>(first + count),
+                   static_cast<void *>(first),
+                   (size_ - offset) * sizeof(value_type));
+    } else {
+      for (T *src = data_ + size_; src != first;) {
+        --src;
+        alloc_traits::construct(alloc_, src + count, std::move(*src));
+        alloc_traits::destroy(alloc_, src);
+      }
+    }
+  }
+
+  // Обратно к shift_tail: закрывает дыру из count ячеек в offset
+  void unshift_tail(size_type offset, size_type count) noexcept {
+    T *first = data_ + offset;
+    if constexpr (kRelocateBytes) {
+      std::memmove(static_cast<void *>(first),
+                   static_cast<void *>(first + count),
+                   (size_ - offset) * sizeof(value_type));
+    } else {
+      for (T *dest = first; dest != data_ + size_; ++dest) {
+        alloc_traits::construct(alloc_, dest, std::move(dest[count]));
+        alloc_traits::destroy(alloc_, dest + count);
+      }
+    }
+  }
+
+  // Вставляет count элементов в позицию offset: construct(slot, i) создает
+  // i-й из них в сырой ячейке slot. Если емкости хватает и хвост можно
+  // сдвинуть, он сдвигается на месте один раз на всю пачку, иначе новые
+  // элементы создаются в новом буфере раньше переноса старых. При
+  // исключении вектор остается прежним.
+  template <typename Construct>
+  T *insert_with(size_type offset, size_type count, Construct construct) {
+    if (count == 0) {
+      return data_ + offset;
+    }
+    if (capacity_ - size_ >= count && (kShiftInPlace || offset == size_)) {
+      shift_tail(offset, count);
+      T *gap = data_ + offset;
+      size_type done = 0;
+      try {
+        for (; done < count; ++done) {
+          construct(gap + done, done);
+        }
+      } catch (...) {
+        destroy(gap, gap + done);
+        unshift_tail(offset, count);
+        throw;
+      }
+      size_ += count;
+      return gap;
+    }
+
+    if (count > max_size() - size_) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    // Место есть, но хвост нельзя сдвинуть на месте: переезд в буфер той же
+    // емкости, иначе каждая вставка в середину растила бы емкость
+    size_type new_capacity =
+        capacity_ - size_ >= count ? capacity_ : recommend(size_ + count);
+    T *new_data = self().allocate(new_capacity);
+    T *gap = new_data + offset;
+    size_type done = 0;
+    try {
+      for (; done < count; ++done) {
+        construct(gap + done, done);
+      }
+    } catch (...) {
+      destroy(gap, gap + done);
+      self().deallocate(new_data, new_capacity);
+      throw;
+    }
+    T *prefix_end = new_data;
+    try {
+      prefix_end = move_into(data_, data_ + offset, new_data);
+      move_into(data_ + offset, data_ + size_, gap + count);
+    } catch (...) {
+      destroy(new_data, prefix_end);
+      destroy(gap, gap + count);
+      self().deallocate(new_data, new_capacity);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+    size_ += count;
+    return gap;
+  }
+
+  void destroy(T *first, T *last) noexcept {
+    for (; first != last; ++first) {
+      alloc_traits::destroy(alloc_, first);
+    }
+  }
+
+  // Емкость для new_size элементов с учетом множителя роста
+  size_type recommend(size_type new_size) const {
+    if (new_size > max_size()) {
+      throw std::length_error("vector size exceeds max_size");
+    }
+    size_type grown = capacity_;
+    if (grown <= max_size() / S21_VECTOR_GROWTH_NUM) {
+      grown = grown * S21_VECTOR_GROWTH_NUM / S21_VECTOR_GROWTH_DEN;
+    } else {
+      grown = max_size();
+    }
+    return grown > new_size ? grown : new_size;
+  }
+
+  // Конструирует [first, last) в сырой памяти dest, исходники не трогает.
+  // Если перемещение может бросить, элементы копируются (move_if_noexcept),
+  // так что при исключении исходный вектор остается целым.
+  T *move_into(T *first, T *last, T *dest) {
+    if constexpr (kRelocateBytes) {
+      if (first != last) {
+        std::memcpy(static_cast<void *>(dest), static_cast<void *>(first),
+                    (last - first) * sizeof(value_type));
+      }
+      return dest + (last - first);
+    }
+    T *constructed = dest;
+    try {
+      for (T *it = first; it != last; ++it, ++constructed) {
+        alloc_traits::construct(alloc_, constructed,
+                                std::move_if_noexcept(*it));
+      }
+    } catch (...) {
+      destroy(dest, constructed);
+      throw;
+    }
+    return constructed;
+  }
+
+  // Заменяет буфер на new_data (элементы уже перенесены туда)
+  void adopt(T *new_data, size_type new_capacity) noexcept {
+    if constexpr (!kRelocateBytes) {
+      destroy(data_, data_ + size_);
+    }
+    self().deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  // Переносит элементы в новый буфер на new_capacity ячеек
+  void relocate(size_type new_capacity) {
+    if constexpr (kReallocate) {
+      if (self().can_reallocate(new_capacity)) {
+        data_ = alloc_.reallocate(data_, capacity_, new_capacity);
+        capacity_ = new_capacity;
+        return;
+      }
+    }
+    T *new_data = self().allocate(new_capacity);
+    try {
+      move_into(data_, data_ + size_, new_data);
+    } catch (...) {
+      self().deallocate(new_data, new_capacity);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+  }
+
+  // Добавляет элемент в конец полного вектора: новый элемент создается в
+  // новом буфере раньше переноса старых, поэтому args могут ссылаться на
+  // элементы самого вектора.
+  template <typename... Args>
+  void realloc_append(Args &&...args) {
+    size_type new_capacity = recommend(size_ + 1);
+    if constexpr (kReallocate) {
+      if (self().can_reallocate(new_capacity)) {
+        // realloc может сдвинуть буфер, поэтому значение создается заранее
+        value_type value(std::forward<Args>(args)...);
+        relocate(new_capacity);
+        alloc_traits::construct(alloc_, data_ + size_, std::move(value));
+        size_++;
+        return;
+      }
+    }
+    T *new_data = self().allocate(new_capacity);
+    try {
+      alloc_traits::construct(alloc_, new_data + size_,
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      self().deallocate(new_data, new_capacity);
+      throw;
+    }
+    try {
+      move_into(data_, data_ + size_, new_data);
+    } catch (...) {
+      alloc_traits::destroy(alloc_, new_data + size_);
+      self().deallocate(new_data, new_capacity);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+    size_++;
+  }
+
+  T *data_;
+  size_type size_;
+  size_type capacity_;
+  Allocator alloc_;
+};
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // CONTAINERS_VECTOR_BASE_H
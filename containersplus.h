@@ -5,5 +5,6 @@
 #include <iostream>
 
 #include "./containersplus/array.h"
+#include "./containersplus/padded_array.h"
 
 #endif  // CONTAINERSPLUS_H
@@ -1,11 +1,23 @@
 #ifndef array_H
 #define array_H
 
-#include <algorithm>
 #include <cstddef>
-#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../containers/algorithm.h"
+#include "../containers/hardening.h"
 
 namespace s21 {
+// Массив фиксированного размера - агрегат, как std::array: инициализируется
+// фигурными скобками без конструкторов, копируется и перемещается
+// поэлементно неявными операциями. Все методы constexpr, поэтому таблицы
+// можно строить при компиляции, и они попадают в .rodata без кода запуска:
+//
+//   constexpr s21::array<std::uint32_t, 256> kCrcTable = make_crc_table();
+//
+// Лишних инициализаторов компилятор не пропустит, недостающие элементы
+// инициализируются нулем.
 template <typename T, std::size_t N>
 class array {
  public:
@@ -16,86 +28,82 @@ class array {
   using const_iterator = const T *;
   using size_type = std::size_t;
 
-  // конструкторы и деструктор
-  // поля инициализируются по умолчанию поэтому default
-  array() noexcept = default;
-
-  array(std::initializer_list<value_type> const &items) {
-    if (items.size() != N) {
-      throw std::runtime_error("unvaliable amount of elements");
-    }
-    std::copy(items.begin(), items.end(), data_);
-  }
-
-  // copy constructor
-  array(const array &a) noexcept { std::copy(a.data_, a.data_ + N, data_); }
-
-  // move constructor
-  array(array &&a) noexcept { std::move(a.data_, a.data_ + N, data_); }
-
-  ~array() noexcept {};
-
-  // Операторы присваивания для lvalue и rvalue
-  array &operator=(const array &a) noexcept {
-    if (this != &a) {
-      for (size_type i = 0; i < N; i++) {
-        data_[i] = a.data_[i];
-      }
-    }
-    return *this;
-  }
-
-  array &operator=(array &&a) noexcept {
-    if (this != &a) {
-      for (size_type i = 0; i < N; i++) {
-        data_[i] = std::move(a.data_[i]);
-      }
+  // Методы доступа к элементам
+  constexpr reference at(size_type pos) {
+    if (pos >= N) {
+      throw std::out_of_range("array::at out of range");
     }
-    return *this;
+    return data_[pos];
   }
-
-  // Методы доступа к элементам
-  reference at(size_type pos) {
+  constexpr const_reference at(size_type pos) const {
     if (pos >= N) {
       throw std::out_of_range("array::at out of range");
     }
     return data_[pos];
   }
 
-  reference operator[](size_type pos) { return at(pos); }
-
-  const_reference front() const noexcept { return data_[0]; }
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  constexpr reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < N, "array index out of range");
+    return data_[pos];
+  }
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < N, "array index out of range");
+    return data_[pos];
+  }
 
-  const_reference back() const noexcept { return data_[N - 1]; }
-  iterator data() noexcept { return data_; }
+  constexpr reference front() noexcept { return data_[0]; }
+  constexpr const_reference front() const noexcept { return data_[0]; }
+  constexpr reference back() noexcept { return data_[N - 1]; }
+  constexpr const_reference back() const noexcept { return data_[N - 1]; }
+  constexpr iterator data() noexcept { return data_; }
+  constexpr const_iterator data() const noexcept { return data_; }
 
   // Методы для итерации по массиву
-  iterator begin() noexcept { return data_; }
-  const_iterator cbegin() const noexcept { return data_; }
-  iterator end() noexcept { return data_ + N; }
-  const_iterator cend() const noexcept { return data_ + N; }
+  constexpr iterator begin() noexcept { return data_; }
+  constexpr const_iterator begin() const noexcept { return data_; }
+  constexpr const_iterator cbegin() const noexcept { return data_; }
+  constexpr iterator end() noexcept { return data_ + N; }
+  constexpr const_iterator end() const noexcept { return data_ + N; }
+  constexpr const_iterator cend() const noexcept { return data_ + N; }
 
   // Методы для определения размеров и пустоты
-  bool empty() const noexcept { return N == 0; }
-  size_type size() const noexcept { return N; }
-  size_type max_size() const noexcept { return size(); }
+  constexpr bool empty() const noexcept { return N == 0; }
+  constexpr size_type size() const noexcept { return N; }
+  constexpr size_type max_size() const noexcept { return size(); }
 
   // Метод для обмена содержимым с другим массивом
-  void swap(array &other) noexcept {
-    std::swap_ranges(data_, data_ + N, other.data_);
+  constexpr void swap(array &other) noexcept {
+    for (size_type i = 0; i < N; i++) {
+      detail::swap_values(data_[i], other.data_[i]);
+    }
   }
 
-  // Метод для заполнения массива значениями
-  void fill(const_reference value) noexcept {
-    for (size_t i = 0; i < N; i++) {
-      data_[i] = value;
-    }
+  // Метод для заполнения массива значениями (во время выполнения - через
+  // ядра s21::simd)
+  constexpr void fill(const_reference value) noexcept {
+    s21::fill(data_, data_ + N, value);
   }
 
- private:
+  // Открыто только ради агрегатной инициализации, обращаться через data()
   value_type data_[N] = {};
 };
 
+template <typename T, std::size_t N>
+constexpr bool operator==(const array<T, N> &a, const array<T, N> &b) {
+  for (std::size_t i = 0; i < N; i++) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator!=(const array<T, N> &a, const array<T, N> &b) {
+  return !(a == b);
+}
+
 }  // namespace s21
 
 #endif  // array_H
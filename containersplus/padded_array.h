@@ -0,0 +1,202 @@
+#ifndef CONTAINERSPLUS_PADDED_ARRAY_H
+#define CONTAINERSPLUS_PADDED_ARRAY_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../containers/hardening.h"
+
+// Размер строки кэша, на которую padded_array раскладывает элементы.
+// Процессоры Intel подтягивают строки парами, для них честнее 128.
+#ifndef S21_CACHE_LINE_SIZE
+#define S21_CACHE_LINE_SIZE 64
+#endif
+
+namespace s21 {
+
+// Массив фиксированного размера, каждый элемент которого занимает свою
+// строку кэша (Align байт, по умолчанию S21_CACHE_LINE_SIZE), а весь
+// массив выровнен на Align. Нужен для данных, которые пишут разные потоки:
+// в обычном массиве соседние счетчики делят строку, и каждое приращение
+// отбирает ее у других ядер (false sharing).
+//
+//   s21::padded_array<std::atomic<std::uint64_t>, 64> hits;
+//   hits[thread_id].fetch_add(1, std::memory_order_relaxed);
+//
+// Платой служит память: N * Align байт вместо N * sizeof(T). Элементы не
+// лежат подряд, поэтому data() нет; итераторы произвольного доступа
+// шагают по строкам. Элементы инициализируются значением (T{}), так что
+// годятся и некопируемые типы вроде std::atomic.
+template <typename T, std::size_t N, std::size_t Align = S21_CACHE_LINE_SIZE>
+class padded_array {
+  static_assert((Align & (Align - 1)) == 0, "alignment must be a power of 2");
+  static_assert(Align >= alignof(T), "alignment is weaker than alignof(T)");
+
+  // Элемент, дополненный до целого числа строк
+  struct alignas(Align) slot {
+    T value{};
+  };
+
+  template <bool Const>
+  class SlotIterator;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = SlotIterator<false>;
+  using const_iterator = SlotIterator<true>;
+  using size_type = std::size_t;
+
+  static constexpr size_type alignment = Align;
+
+  constexpr padded_array() = default;
+
+  constexpr reference at(size_type pos) {
+    if (pos >= N) {
+      throw std::out_of_range("array::at out of range");
+    }
+    return slots_[pos].value;
+  }
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= N) {
+      throw std::out_of_range("array::at out of range");
+    }
+    return slots_[pos].value;
+  }
+
+  // Без проверки индекса, проверяет at() (или сборка с S21_HARDENED)
+  constexpr reference operator[](size_type pos) noexcept {
+    S21_HARDENING_ASSERT(pos < N, "padded_array index out of range");
+    return slots_[pos].value;
+  }
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    S21_HARDENING_ASSERT(pos < N, "padded_array index out of range");
+    return slots_[pos].value;
+  }
+
+  constexpr reference front() noexcept { return slots_[0].value; }
+  constexpr const_reference front() const noexcept { return slots_[0].value; }
+  constexpr reference back() noexcept { return slots_[N - 1].value; }
+  constexpr const_reference back() const noexcept {
+    return slots_[N - 1].value;
+  }
+
+  iterator begin() noexcept { return iterator(slots_); }
+  const_iterator begin() const noexcept { return const_iterator(slots_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return iterator(slots_ + N); }
+  const_iterator end() const noexcept { return const_iterator(slots_ + N); }
+  const_iterator cend() const noexcept { return end(); }
+
+  constexpr bool empty() const noexcept { return N == 0; }
+  constexpr size_type size() const noexcept { return N; }
+  constexpr size_type max_size() const noexcept { return N; }
+
+  // value присваивается каждому элементу; U может отличаться от T, чтобы
+  // заполнять, например, std::atomic<int> числом
+  template <typename U>
+  constexpr void fill(const U &value) {
+    for (size_type i = 0; i < N; i++) {
+      slots_[i].value = value;
+    }
+  }
+
+ private:
+  slot slots_[N];
+
+  template <bool Const>
+  class SlotIterator {
+    using slot_pointer = std::conditional_t<Const, const slot *, slot *>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    SlotIterator() noexcept : slot_(nullptr) {}
+    explicit SlotIterator(slot_pointer s) noexcept : slot_(s) {}
+    // iterator -> const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    SlotIterator(const SlotIterator<false> &other) noexcept
+        : slot_(other.slot_) {}
+
+    reference operator*() const noexcept { return slot_->value; }
+    pointer operator->() const noexcept { return &slot_->value; }
+    reference operator[](difference_type n) const noexcept {
+      return slot_[n].value;
+    }
+
+    SlotIterator &operator++() noexcept {
+      slot_++;
+      return *this;
+    }
+    SlotIterator operator++(int) noexcept {
+      SlotIterator tmp(*this);
+      slot_++;
+      return tmp;
+    }
+    SlotIterator &operator--() noexcept {
+      slot_--;
+      return *this;
+    }
+    SlotIterator operator--(int) noexcept {
+      SlotIterator tmp(*this);
+      slot_--;
+      return tmp;
+    }
+    SlotIterator &operator+=(difference_type n) noexcept {
+      slot_ += n;
+      return *this;
+    }
+    SlotIterator &operator-=(difference_type n) noexcept {
+      slot_ -= n;
+      return *this;
+    }
+    friend SlotIterator operator+(SlotIterator it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend SlotIterator operator+(difference_type n, SlotIterator it) noexcept {
+      return it += n;
+    }
+    friend SlotIterator operator-(SlotIterator it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const SlotIterator &a,
+                                     const SlotIterator &b) noexcept {
+      return a.slot_ - b.slot_;
+    }
+
+    bool operator==(const SlotIterator &other) const noexcept {
+      return slot_ == other.slot_;
+    }
+    bool operator!=(const SlotIterator &other) const noexcept {
+      return slot_ != other.slot_;
+    }
+    bool operator<(const SlotIterator &other) const noexcept {
+      return slot_ < other.slot_;
+    }
+    bool operator>(const SlotIterator &other) const noexcept {
+      return slot_ > other.slot_;
+    }
+    bool operator<=(const SlotIterator &other) const noexcept {
+      return slot_ <= other.slot_;
+    }
+    bool operator>=(const SlotIterator &other) const noexcept {
+      return slot_ >= other.slot_;
+    }
+
+   private:
+    friend class SlotIterator<!Const>;
+
+    slot_pointer slot_;
+  };
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERSPLUS_PADDED_ARRAY_H
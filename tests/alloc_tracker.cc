@@ -0,0 +1,181 @@
+#include "alloc_tracker.h"
+
+#include <atomic>
+#include <cstdlib>
+
+namespace alloc_tracker {
+namespace {
+
+std::atomic<std::size_t> allocations{0};
+std::atomic<std::size_t> deallocations{0};
+std::atomic<std::size_t> bytes{0};
+std::atomic<std::size_t> live_bytes{0};
+std::atomic<std::size_t> peak_live_bytes{0};
+
+// Перед каждым блоком лежит заголовок: [смещение до начала блока][размер].
+// Так operator delete узнает размер даже без sized deallocation.
+constexpr std::size_t kHeader = alignof(std::max_align_t);
+
+void record_alloc(std::size_t size) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  bytes.fetch_add(size, std::memory_order_relaxed);
+  std::size_t live = live_bytes.fetch_add(size, std::memory_order_relaxed);
+  live += size;
+  std::size_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_live_bytes.compare_exchange_weak(
+                            peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void record_free(std::size_t size) noexcept {
+  deallocations.fetch_add(1, std::memory_order_relaxed);
+  live_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+void *tracked_alloc(std::size_t size, std::size_t align) noexcept {
+  std::size_t header = align > kHeader ? align : kHeader;
+  void *raw = nullptr;
+  if (align > kHeader) {
+    std::size_t total = (size + header + align - 1) / align * align;
+    raw = std::aligned_alloc(align, total);
+  } else {
+    raw = std::malloc(size + header);
+  }
+  if (raw == nullptr) {
+    return nullptr;
+  }
+  std::size_t *user =
+      reinterpret_cast<std::size_t *>(static_cast<char *>(raw) + header);
+  user[-1] = size;
+  user[-2] = header;
+  record_alloc(size);
+  return user;
+}
+
+void tracked_free(void *p) noexcept {
+  if (p == nullptr) {
+    return;
+  }
+  std::size_t *user = static_cast<std::size_t *>(p);
+  std::size_t size = user[-1];
+  std::size_t header = user[-2];
+  record_free(size);
+  std::free(static_cast<char *>(p) - header);
+}
+
+void *throwing_alloc(std::size_t size, std::size_t align) {
+  void *p = tracked_alloc(size == 0 ? 1 : size, align);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+}  // namespace
+
+AllocStats current() noexcept {
+  AllocStats stats;
+  stats.allocations = allocations.load(std::memory_order_relaxed);
+  stats.deallocations = deallocations.load(std::memory_order_relaxed);
+  stats.bytes = bytes.load(std::memory_order_relaxed);
+  stats.live_bytes = live_bytes.load(std::memory_order_relaxed);
+  stats.peak_live_bytes = peak_live_bytes.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void reset() noexcept {
+  allocations.store(0, std::memory_order_relaxed);
+  deallocations.store(0, std::memory_order_relaxed);
+  bytes.store(0, std::memory_order_relaxed);
+  peak_live_bytes.store(live_bytes.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+}
+
+AllocScope::AllocScope() noexcept {
+  peak_live_bytes.store(live_bytes.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+  start_ = current();
+}
+
+AllocStats AllocScope::stats() const noexcept {
+  AllocStats now = current();
+  AllocStats delta;
+  delta.allocations = now.allocations - start_.allocations;
+  delta.deallocations = now.deallocations - start_.deallocations;
+  delta.bytes = now.bytes - start_.bytes;
+  delta.live_bytes =
+      now.live_bytes > start_.live_bytes ? now.live_bytes - start_.live_bytes
+                                         : 0;
+  delta.peak_live_bytes = now.peak_live_bytes > start_.live_bytes
+                              ? now.peak_live_bytes - start_.live_bytes
+                              : 0;
+  return delta;
+}
+
+}  // namespace alloc_tracker
+
+// Подмена глобальных операторов
+
+void *operator new(std::size_t size) {
+  return alloc_tracker::throwing_alloc(size, 0);
+}
+void *operator new[](std::size_t size) {
+  return alloc_tracker::throwing_alloc(size, 0);
+}
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return alloc_tracker::tracked_alloc(size == 0 ? 1 : size, 0);
+}
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return alloc_tracker::tracked_alloc(size == 0 ? 1 : size, 0);
+}
+void *operator new(std::size_t size, std::align_val_t align) {
+  return alloc_tracker::throwing_alloc(size, static_cast<std::size_t>(align));
+}
+void *operator new[](std::size_t size, std::align_val_t align) {
+  return alloc_tracker::throwing_alloc(size, static_cast<std::size_t>(align));
+}
+void *operator new(std::size_t size, std::align_val_t align,
+                   const std::nothrow_t &) noexcept {
+  return alloc_tracker::tracked_alloc(size == 0 ? 1 : size,
+                                      static_cast<std::size_t>(align));
+}
+void *operator new[](std::size_t size, std::align_val_t align,
+                     const std::nothrow_t &) noexcept {
+  return alloc_tracker::tracked_alloc(size == 0 ? 1 : size,
+                                      static_cast<std::size_t>(align));
+}
+
+void operator delete(void *p) noexcept { alloc_tracker::tracked_free(p); }
+void operator delete[](void *p) noexcept { alloc_tracker::tracked_free(p); }
+void operator delete(void *p, std::size_t) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete[](void *p, std::size_t) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete(void *p, std::align_val_t) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete[](void *p, std::align_val_t) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete(void *p, std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  alloc_tracker::tracked_free(p);
+}
+void operator delete[](void *p, std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  alloc_tracker::tracked_free(p);
+}
@@ -0,0 +1,87 @@
+#ifndef CONTAINERS_ALLOC_TRACKER_H_
+#define CONTAINERS_ALLOC_TRACKER_H_
+
+#include <cstddef>
+#include <new>
+
+// Учет обращений к куче. alloc_tracker.cc подменяет глобальные operator
+// new/delete, поэтому любой бинарник, собранный вместе с ним (тесты,
+// бенчмарки), считает все аллокации процесса.
+namespace alloc_tracker {
+
+struct AllocStats {
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+  std::size_t bytes = 0;            // сколько байт запрошено всего
+  std::size_t live_bytes = 0;       // сколько байт занято сейчас
+  std::size_t peak_live_bytes = 0;  // максимум live_bytes
+};
+
+// Состояние глобальных счетчиков с момента последнего reset()
+AllocStats current() noexcept;
+// Обнуляет счетчики, пик отсчитывается от текущего объема занятой памяти
+void reset() noexcept;
+
+// Замер аллокаций внутри области видимости:
+//   alloc_tracker::AllocScope scope;
+//   ... workload ...
+//   EXPECT_LE(scope.stats().allocations, 25u);
+// Пик считается относительно памяти, занятой на момент создания scope.
+// Вложенные scope сбрасывают пик внешнего.
+class AllocScope {
+ public:
+  AllocScope() noexcept;
+  AllocStats stats() const noexcept;
+
+ private:
+  AllocStats start_;
+};
+
+// Аллокатор, который считает свои вызовы в отдельный AllocStats. Подходит
+// для любого контейнера, принимающего аллокатор, и не зависит от подмены
+// глобального operator new.
+template <typename T>
+class counting_allocator {
+ public:
+  using value_type = T;
+
+  explicit counting_allocator(AllocStats *stats) noexcept : stats_(stats) {}
+  template <typename U>
+  counting_allocator(const counting_allocator<U> &other) noexcept
+      : stats_(other.stats()) {}
+
+  T *allocate(std::size_t n) {
+    T *p = static_cast<T *>(::operator new(n * sizeof(T)));
+    stats_->allocations++;
+    stats_->bytes += n * sizeof(T);
+    stats_->live_bytes += n * sizeof(T);
+    if (stats_->live_bytes > stats_->peak_live_bytes) {
+      stats_->peak_live_bytes = stats_->live_bytes;
+    }
+    return p;
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept {
+    stats_->deallocations++;
+    stats_->live_bytes -= n * sizeof(T);
+    ::operator delete(p);
+  }
+
+  AllocStats *stats() const noexcept { return stats_; }
+
+  template <typename U>
+  bool operator==(const counting_allocator<U> &other) const noexcept {
+    return stats_ == other.stats();
+  }
+  template <typename U>
+  bool operator!=(const counting_allocator<U> &other) const noexcept {
+    return stats_ != other.stats();
+  }
+
+ private:
+  AllocStats *stats_;
+};
+
+}  // namespace alloc_tracker
+
+#endif  // CONTAINERS_ALLOC_TRACKER_H_
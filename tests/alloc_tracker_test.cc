@@ -0,0 +1,89 @@
+#include "test_start.h"
+
+TEST(AllocTrackerTest, CountsNewAndDelete) {
+  alloc_tracker::AllocScope scope;
+  int *value = new int(5);
+  alloc_tracker::AllocStats stats = scope.stats();
+  EXPECT_EQ(stats.allocations, 1UL);
+  EXPECT_EQ(stats.bytes, sizeof(int));
+  EXPECT_EQ(stats.live_bytes, sizeof(int));
+  delete value;
+  stats = scope.stats();
+  EXPECT_EQ(stats.deallocations, 1UL);
+  EXPECT_EQ(stats.live_bytes, 0UL);
+  EXPECT_EQ(stats.peak_live_bytes, sizeof(int));
+}
+
+TEST(AllocTrackerTest, PeakLiveBytes) {
+  alloc_tracker::AllocScope scope;
+  char *first = new char[100];
+  char *second = new char[200];
+  delete[] first;
+  char *third = new char[50];
+  delete[] second;
+  delete[] third;
+  alloc_tracker::AllocStats stats = scope.stats();
+  EXPECT_EQ(stats.allocations, 3UL);
+  EXPECT_EQ(stats.deallocations, 3UL);
+  EXPECT_EQ(stats.bytes, 350UL);
+  EXPECT_EQ(stats.peak_live_bytes, 300UL);
+  EXPECT_EQ(stats.live_bytes, 0UL);
+}
+
+TEST(AllocTrackerTest, AlignedNew) {
+  struct alignas(64) Line {
+    char bytes[64];
+  };
+  alloc_tracker::AllocScope scope;
+  Line *line = new Line;
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(line) % 64, 0UL);
+  delete line;
+  EXPECT_EQ(scope.stats().allocations, 1UL);
+  EXPECT_EQ(scope.stats().live_bytes, 0UL);
+}
+
+TEST(AllocTrackerTest, CountingAllocator) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  std::vector<int, alloc_tracker::counting_allocator<int>> v(alloc);
+  v.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(stats.allocations, 1UL);
+  EXPECT_EQ(stats.bytes, 10 * sizeof(int));
+  EXPECT_EQ(stats.peak_live_bytes, 10 * sizeof(int));
+}
+
+TEST(AllocTrackerTest, VectorReserveAllocatesOnce) {
+  s21::vector<int> v;
+  alloc_tracker::AllocScope scope;
+  v.reserve(1000);
+  EXPECT_EQ(scope.stats().allocations, 1UL);
+  EXPECT_GE(scope.stats().bytes, 1000 * sizeof(int));
+}
+
+TEST(AllocTrackerTest, MapInsertAllocatesOneNodePerKey) {
+  s21::map<int, int> m;
+  alloc_tracker::AllocScope scope;
+  for (int i = 0; i < 100; i++) {
+    m.insert(i, i);
+  }
+  // повторная вставка того же ключа не должна оставлять память занятой
+  m.insert(0, 0);
+  alloc_tracker::AllocStats stats = scope.stats();
+  EXPECT_LE(stats.allocations, 101UL);
+  EXPECT_EQ(stats.live_bytes, stats.bytes / stats.allocations * 100);
+}
+
+TEST(AllocTrackerTest, StackPushReleasesOldBuffers) {
+  alloc_tracker::AllocScope scope;
+  {
+    s21::stack<int> s;
+    for (int i = 0; i < 1000; i++) {
+      s.push(i);
+    }
+    EXPECT_LE(scope.stats().allocations, 1000UL);
+  }
+  EXPECT_EQ(scope.stats().live_bytes, 0UL);
+}
@@ -0,0 +1,111 @@
+#include "test_start.h"
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <string>
+#include <thread>
+
+TEST(ArenaTest, AllocatesAligned) {
+  s21::arena a(256);
+  void *first = a.allocate(1, 1);
+  void *second = a.allocate(8, 64);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % 64, 0UL);
+  EXPECT_EQ(a.bytes_used(), 9UL);
+}
+
+TEST(ArenaTest, LargeRequestGetsOwnBlock) {
+  s21::arena a(128);
+  char *big = static_cast<char *>(a.allocate(1000, 8));
+  big[999] = 'x';
+  EXPECT_GE(a.bytes_reserved(), 1000UL);
+}
+
+TEST(ArenaTest, OversizedRequestThrows) {
+  s21::arena a;
+  s21::arena_allocator<std::uint64_t> alloc(a);
+  // n * sizeof(T) переполнился бы и дал крошечный блок
+  EXPECT_THROW(alloc.allocate(std::numeric_limits<std::size_t>::max() / 4),
+               std::bad_array_new_length);
+  EXPECT_THROW(a.allocate(std::numeric_limits<std::size_t>::max() - 8, 16),
+               std::bad_alloc);
+  EXPECT_EQ(a.bytes_used(), 0UL);
+}
+
+TEST(ArenaTest, ResetReusesBlocks) {
+  s21::arena a(1024);
+  for (int i = 0; i < 100; i++) {
+    a.allocate(64, 8);
+  }
+  std::size_t reserved = a.bytes_reserved();
+  a.reset();
+  EXPECT_EQ(a.bytes_used(), 0UL);
+
+  alloc_tracker::AllocScope scope;
+  for (int i = 0; i < 100; i++) {
+    a.allocate(64, 8);
+  }
+  EXPECT_EQ(scope.stats().allocations, 0UL);
+  EXPECT_EQ(a.bytes_reserved(), reserved);
+}
+
+TEST(ArenaTest, LocalArenaIsPerThread) {
+  s21::arena *main_arena = &s21::arena::local();
+  s21::arena *other_arena = nullptr;
+  std::thread worker([&other_arena] { other_arena = &s21::arena::local(); });
+  worker.join();
+  EXPECT_EQ(&s21::arena::local(), main_arena);
+  EXPECT_NE(other_arena, main_arena);
+}
+
+TEST(ArenaTest, ContainersUseArena) {
+  s21::arena a;
+  s21::arena_allocator<int> alloc(a);
+  s21::vector<int, s21::arena_allocator<int>> v({1, 2, 3}, alloc);
+  s21::list<int, s21::arena_allocator<int>> l({4, 5}, alloc);
+  s21::map<int, int, s21::arena_allocator<std::pair<const int, int>>> m(
+      alloc);
+  m.insert(1, 10);
+  m.insert(2, 20);
+  EXPECT_EQ(v[2], 3);
+  EXPECT_EQ(l.back(), 5);
+  EXPECT_EQ(m.at(2), 20);
+  EXPECT_GT(a.bytes_used(), 0UL);
+}
+
+TEST(ArenaTest, DestructionSkipsNodeWalk) {
+  s21::arena a;
+  s21::arena_allocator<int> alloc(a);
+  alloc_tracker::AllocScope scope;
+  {
+    s21::list<int, s21::arena_allocator<int>> l(alloc);
+    s21::set<int, s21::arena_allocator<int>> s(alloc);
+    for (int i = 0; i < 1000; i++) {
+      l.push_back(i);
+      s.insert(i);
+    }
+    l.clear();
+    EXPECT_TRUE(l.empty());
+    l.push_back(42);
+    EXPECT_EQ(l.front(), 42);
+  }
+  a.reset();
+  EXPECT_EQ(a.bytes_used(), 0UL);
+  // вся память пришла из арены, глобальная куча задействована только
+  // для ее блоков
+  EXPECT_EQ(scope.stats().deallocations, 0UL);
+}
+
+TEST(ArenaTest, NonTrivialElementsAreStillDestroyed) {
+  s21::arena a;
+  s21::arena_allocator<std::string> alloc(a);
+  alloc_tracker::AllocScope scope;
+  {
+    s21::list<std::string, s21::arena_allocator<std::string>> l(alloc);
+    l.push_back("a string long enough to live on the heap");
+  }
+  // в куче остался только блок арены, буфер строки освобожден
+  alloc_tracker::AllocStats stats = scope.stats();
+  EXPECT_EQ(stats.allocations - stats.deallocations, 1UL);
+}
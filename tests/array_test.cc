@@ -1,4 +1,6 @@
 #include <array>
+#include <cstdint>
+#include <type_traits>
 
 #include "test_start.h"
 
@@ -215,3 +217,119 @@ TEST(ArrayTest, OperatorBracket) {
   arr[2] = 10;
   EXPECT_EQ(arr[2], 10);
 }
+
+TEST(ArrayTest, ConstOperatorBracket) {
+  const s21::array<int, 3> arr = {7, 8, 9};
+  EXPECT_EQ(arr[0], 7);
+  EXPECT_EQ(arr[2], 9);
+}
+
+namespace {
+// Таблица CRC-32 (полином 0xEDB88320), построенная при компиляции
+constexpr s21::array<std::uint32_t, 256> make_crc_table() {
+  s21::array<std::uint32_t, 256> table{};
+  for (std::uint32_t i = 0; i < 256; i++) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr s21::array<std::uint32_t, 256> kCrcTable = make_crc_table();
+
+constexpr std::uint32_t crc32(const char *text) {
+  std::uint32_t crc = 0xFFFFFFFFu;
+  for (; *text; text++) {
+    crc = kCrcTable[(crc ^ static_cast<unsigned char>(*text)) & 0xFF] ^
+          (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+// Обратная перестановка к отсортированной: номер каждого элемента в
+// отсортированном порядке
+template <std::size_t N>
+constexpr s21::array<std::size_t, N> rank_of(s21::array<int, N> values) {
+  s21::array<int, N> sorted = values;
+  s21::sort(sorted.begin(), sorted.end());
+  s21::array<std::size_t, N> ranks{};
+  s21::transform(values.begin(), values.end(), ranks.begin(),
+                 [&sorted](int v) {
+                   return static_cast<std::size_t>(
+                       s21::find(sorted.begin(), sorted.end(), v) -
+                       sorted.begin());
+                 });
+  return ranks;
+}
+
+constexpr s21::array<int, 40> descending() {
+  s21::array<int, 40> a{};
+  for (int i = 0; i < 40; i++) {
+    a[i] = 40 - i;
+  }
+  s21::sort(a.begin(), a.end());
+  return a;
+}
+}  // namespace
+
+static_assert(std::is_aggregate<s21::array<int, 3>>::value);
+static_assert(std::is_trivially_copyable<s21::array<int, 3>>::value);
+
+TEST(ArrayTest, ConstexprTables) {
+  static_assert(kCrcTable[0] == 0);
+  static_assert(kCrcTable[1] == 0x77073096u);
+  static_assert(kCrcTable[255] == 0x2D02EF8Du);
+  static_assert(crc32("123456789") == 0xCBF43926u);
+
+  constexpr s21::array<int, 5> values = {30, 10, 50, 20, 40};
+  constexpr auto ranks = rank_of(values);
+  static_assert(ranks == s21::array<std::size_t, 5>{2, 0, 4, 1, 3});
+
+  // больше 16 элементов - пирамидальная сортировка
+  constexpr auto sorted = descending();
+  static_assert(sorted.front() == 1 && sorted.back() == 40);
+  static_assert(sorted[19] == 20);
+
+  constexpr auto filled = [] {
+    s21::array<double, 4> a{};
+    a.fill(2.5);
+    s21::array<double, 4> b = {1, 2, 3, 4};
+    a.swap(b);
+    return b;
+  }();
+  static_assert(filled[3] == 2.5 && filled.at(0) == 2.5);
+  static_assert(s21::array<int, 3>{1, 2}.back() == 0);
+  EXPECT_EQ(crc32("123456789"), 0xCBF43926u);
+}
+
+TEST(ArrayTest, AlgorithmsAtRuntime) {
+  s21::vector<int> v;
+  for (int i = 0; i < 1000; i++) {
+    v.push_back((i * 7919) % 1000);
+  }
+  s21::sort(v.data(), v.data() + v.size());
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(v[i], i);
+  }
+  EXPECT_EQ(s21::find(v.data(), v.data() + v.size(), 500) - v.data(), 500);
+  EXPECT_EQ(s21::find(v.data(), v.data() + v.size(), -1), v.data() + v.size());
+  s21::fill(v.data(), v.data() + 10, 7);
+  EXPECT_EQ(v[9], 7);
+  EXPECT_EQ(v[10], 10);
+  s21::transform(v.data(), v.data() + v.size(), v.data(), v.data(),
+                 [](int a, int b) { return a + b; });
+  EXPECT_EQ(v[999], 1998);
+
+  s21::list<int> l = {3, 1, 2};
+  EXPECT_EQ(*s21::find(l.begin(), l.end(), 1), 1);
+}
+
+#ifdef S21_HARDENED
+TEST(ArrayTest, HardenedOperatorBracket) {
+  s21::array<int, 3> arr = {1, 2, 3};
+  EXPECT_DEATH(arr[3], "array index out of range");
+}
+#endif
@@ -0,0 +1,205 @@
+#include "test_start.h"
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace {
+template <typename C, typename = void>
+struct has_data : std::false_type {};
+template <typename C>
+struct has_data<C, std::void_t<decltype(std::declval<C &>().data())>>
+    : std::true_type {};
+
+// Без data() упакованный вектор не примут s21::simd и s21::parallel,
+// которые читали бы size() слов
+static_assert(!has_data<s21::vector<bool>>::value);
+static_assert(!has_data<const s21::vector<bool>>::value);
+static_assert(has_data<s21::vector<char>>::value);
+}  // namespace
+
+TEST(BitVectorTest, PackedStorage) {
+  s21::vector<bool> v(1000, true);
+  EXPECT_EQ(v.size(), 1000UL);
+  EXPECT_EQ(v.word_count(), 16UL);
+  EXPECT_EQ(v.count(), 1000UL);
+  EXPECT_TRUE(v.all());
+  // биты за size() в последнем слове нулевые
+  EXPECT_EQ(v.words()[15], (std::uint64_t(1) << 40) - 1);
+}
+
+TEST(BitVectorTest, ProxyReferences) {
+  s21::bit_vector v = {true, false, true};
+  v[1] = true;
+  v[0] = v[2] = false;
+  EXPECT_FALSE(v[0]);
+  EXPECT_TRUE(v[1]);
+  EXPECT_FALSE(v.at(2));
+  v[2].flip();
+  EXPECT_TRUE(v.back());
+  EXPECT_FALSE(~v[2]);
+  EXPECT_THROW(v.at(3), std::out_of_range);
+
+  const s21::bit_vector &cv = v;
+  EXPECT_TRUE(cv[1]);
+  EXPECT_EQ(std::count(cv.begin(), cv.end(), true), 2);
+  for (auto bit : v) {
+    bit = true;
+  }
+  EXPECT_TRUE(v.all());
+}
+
+TEST(BitVectorTest, MatchesStdVectorBool) {
+  std::mt19937 gen(7);
+  s21::vector<bool> v;
+  std::vector<bool> expected;
+  for (int step = 0; step < 5000; step++) {
+    unsigned op = gen() % 6;
+    if (op < 3) {
+      bool value = gen() % 2;
+      v.push_back(value);
+      expected.push_back(value);
+    } else if (op == 3 && !expected.empty()) {
+      v.pop_back();
+      expected.pop_back();
+    } else if (op == 4 && !expected.empty()) {
+      std::size_t pos = gen() % expected.size();
+      v.flip(pos);
+      expected[pos] = !expected[pos];
+    } else if (op == 5) {
+      std::size_t n = gen() % 300;
+      bool value = gen() % 2;
+      v.resize(n, value);
+      expected.resize(n, value);
+    }
+    ASSERT_EQ(v.size(), expected.size());
+  }
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(v[i], expected[i]) << i;
+  }
+  EXPECT_EQ(v.count(), static_cast<std::size_t>(std::count(
+                           expected.begin(), expected.end(), true)));
+}
+
+TEST(BitVectorTest, BulkOperations) {
+  s21::bit_vector a(130), b(130);
+  for (std::size_t i = 0; i < 130; i += 2) {
+    a.set(i);
+  }
+  for (std::size_t i = 0; i < 130; i += 3) {
+    b.set(i);
+  }
+  s21::bit_vector both = a;
+  both &= b;
+  EXPECT_EQ(both.count(), 22UL);
+  s21::bit_vector either = a;
+  either |= b;
+  EXPECT_EQ(either.count(), 65UL + 44 - 22);
+  s21::bit_vector diff = a;
+  diff ^= b;
+  EXPECT_EQ(diff.count(), either.count() - both.count());
+  a.flip();
+  EXPECT_EQ(a.count(), 65UL);
+  EXPECT_THROW(a &= s21::bit_vector(3), std::invalid_argument);
+  EXPECT_NE(a, b);
+  a = b;
+  EXPECT_EQ(a, b);
+}
+
+TEST(BitVectorTest, FindAndIterateSetBits) {
+  s21::bit_vector v(500);
+  EXPECT_EQ(v.find_first(), s21::bit_vector::npos);
+  EXPECT_TRUE(v.none());
+  std::vector<std::size_t> positions = {3, 63, 64, 200, 499};
+  for (std::size_t pos : positions) {
+    v.set(pos);
+  }
+  std::vector<std::size_t> found;
+  for (std::size_t i = v.find_first(); i != s21::bit_vector::npos;
+       i = v.find_next(i)) {
+    found.push_back(i);
+  }
+  EXPECT_EQ(found, positions);
+  found.clear();
+  v.for_each_set([&found](std::size_t i) { found.push_back(i); });
+  EXPECT_EQ(found, positions);
+  v.reset(499);
+  EXPECT_EQ(v.find_next(200), s21::bit_vector::npos);
+}
+
+TEST(BitVectorTest, MoveAndClear) {
+  s21::bit_vector v(100, true);
+  s21::bit_vector moved(std::move(v));
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(moved.count(), 100UL);
+  v = std::move(moved);
+  EXPECT_EQ(v.size(), 100UL);
+  EXPECT_TRUE(moved.empty());
+  v.swap(moved);
+  EXPECT_EQ(moved.size(), 100UL);
+  moved.clear();
+  EXPECT_TRUE(moved.none());
+  moved.reserve(1000);
+  EXPECT_GE(moved.capacity(), 1000UL);
+}
+
+TEST(BitVectorTest, InsertEraseMatchStdVectorBool) {
+  std::mt19937 gen(11);
+  s21::vector<bool> v;
+  std::vector<bool> expected;
+  for (int step = 0; step < 3000; step++) {
+    unsigned op = gen() % 4;
+    std::size_t pos = gen() % (expected.size() + 1);
+    if (op == 0) {
+      std::size_t n = gen() % 150;
+      bool value = gen() % 2;
+      v.insert(v.begin() + pos, n, value);
+      expected.insert(expected.begin() + pos, n, value);
+    } else if (op == 1) {
+      std::vector<bool> items(gen() % 100);
+      for (std::size_t i = 0; i < items.size(); i++) {
+        items[i] = gen() % 2;
+      }
+      v.insert(v.begin() + pos, items.begin(), items.end());
+      expected.insert(expected.begin() + pos, items.begin(), items.end());
+    } else if (!expected.empty()) {
+      pos = gen() % expected.size();
+      std::size_t stop = pos + gen() % (expected.size() - pos + 1);
+      v.erase(v.begin() + pos, v.begin() + stop);
+      expected.erase(expected.begin() + pos, expected.begin() + stop);
+    }
+    ASSERT_EQ(v.size(), expected.size());
+  }
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  EXPECT_EQ(v.count(),
+            static_cast<std::size_t>(
+                std::count(expected.begin(), expected.end(), true)));
+}
+
+TEST(BitVectorTest, VectorModifiers) {
+  s21::vector<bool> v = {true, true};
+  auto it = v.insert(v.begin() + 1, false);
+  EXPECT_EQ(it - v.begin(), 1);
+  EXPECT_EQ(v, s21::vector<bool>({true, false, true}));
+  v.erase(v.begin());
+  EXPECT_EQ(v, s21::vector<bool>({false, true}));
+  EXPECT_THROW(v.erase(v.end()), std::out_of_range);
+  EXPECT_THROW(v.insert(v.end() + 1, true), std::out_of_range);
+
+  v.emplace_back(1) = false;
+  v.emplace(v.begin(), true);
+  EXPECT_EQ(v, s21::vector<bool>({true, false, true, false}));
+  v.insert_many(v.begin() + 2, 0, 1, false);
+  v.insert_many_back(true);
+  EXPECT_EQ(v, s21::vector<bool>(
+                   {true, false, false, true, false, true, false, true}));
+  v.insert(v.end(), {true, true});
+  EXPECT_EQ(v.size(), 10UL);
+
+  v.assign(70, true);
+  EXPECT_EQ(v.count(), 70UL);
+  v.assign({false, true});
+  EXPECT_EQ(v.count(), 1UL);
+  EXPECT_EQ(v.size(), 2UL);
+}
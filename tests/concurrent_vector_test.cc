@@ -0,0 +1,137 @@
+#include "test_start.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ConcurrentVectorTest, Basics) {
+  s21::concurrent_vector<std::string> v = {"a", "b"};
+  auto it = v.push_back("c");
+  EXPECT_EQ(*it, "c");
+  EXPECT_EQ(it - v.begin(), 2);
+  const std::string *first = &v[0];
+  for (int i = 0; i < 10000; i++) {
+    v.emplace_back(std::to_string(i));
+  }
+  // элементы не переезжают при росте
+  EXPECT_EQ(first, &v[0]);
+  EXPECT_EQ(v.size(), 10003UL);
+  EXPECT_GE(v.capacity(), v.size());
+  EXPECT_EQ(v.back(), "9999");
+  EXPECT_EQ(v.at(3), "0");
+  EXPECT_THROW(v.at(10003), std::out_of_range);
+
+  auto range = v.grow_by(3, "x");
+  EXPECT_EQ(range[2], "x");
+  EXPECT_EQ(v.size(), 10006UL);
+  EXPECT_EQ(std::count(v.begin(), v.end(), "x"), 3);
+}
+
+TEST(ConcurrentVectorTest, CopyMoveClear) {
+  s21::concurrent_vector<int> v(5);
+  v.push_back(7);
+  s21::concurrent_vector<int> copy(v);
+  EXPECT_EQ(copy.size(), 6UL);
+  EXPECT_EQ(copy[5], 7);
+  s21::concurrent_vector<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.front(), 0);
+  copy = moved;
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  moved = std::move(copy);
+  EXPECT_EQ(moved.size(), 6UL);
+  moved.swap(copy);
+  EXPECT_EQ(copy[5], 7);
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(ConcurrentVectorTest, ConcurrentPushBack) {
+  const int threads = 8;
+  const int per_thread = 20000;
+  s21::concurrent_vector<long> v;
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back([&v, t] {
+      for (int i = 0; i < per_thread; i++) {
+        auto it = v.push_back(static_cast<long>(t) * per_thread + i);
+        // свой элемент читается сразу после публикации
+        ASSERT_EQ(*it, static_cast<long>(t) * per_thread + i);
+      }
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+  ASSERT_EQ(v.size(), static_cast<size_t>(threads * per_thread));
+  std::vector<long> values(v.begin(), v.end());
+  std::sort(values.begin(), values.end());
+  for (long i = 0; i < threads * per_thread; i++) {
+    ASSERT_EQ(values[i], i);
+  }
+}
+
+TEST(ConcurrentVectorTest, ConcurrentGrowByIsContiguous) {
+  s21::concurrent_vector<int> v;
+  std::vector<std::thread> pool;
+  for (int t = 0; t < 4; t++) {
+    pool.emplace_back([&v, t] {
+      for (int i = 0; i < 500; i++) {
+        auto first = v.grow_by(7, t);
+        for (int j = 0; j < 7; j++) {
+          ASSERT_EQ(first[j], t);
+        }
+      }
+    });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+  ASSERT_EQ(v.size(), 4UL * 500 * 7);
+  // каждый grow_by занимает 7 соседних мест
+  for (size_t i = 0; i < v.size(); i += 7) {
+    for (size_t j = 1; j < 7; j++) {
+      ASSERT_EQ(v[i + j], v[i]);
+    }
+  }
+}
+
+TEST(ConcurrentVectorTest, ReadersSeePublishedElements) {
+  s21::concurrent_vector<std::string> v;
+  std::atomic<size_t> published{0};
+  std::thread writer([&] {
+    for (int i = 0; i < 20000; i++) {
+      v.push_back(std::to_string(i));
+      published.store(i + 1, std::memory_order_release);
+    }
+  });
+  size_t checked = 0;
+  while (checked < 20000) {
+    size_t limit = published.load(std::memory_order_acquire);
+    for (; checked < limit; checked++) {
+      ASSERT_EQ(v[checked], std::to_string(checked));
+    }
+  }
+  writer.join();
+}
+
+TEST(ConcurrentVectorTest, ThrowingConstructorKeepsSlot) {
+  struct Picky {
+    Picky() noexcept = default;
+    explicit Picky(int x) : value(x) {
+      if (x < 0) {
+        throw std::invalid_argument("negative");
+      }
+    }
+    int value = 0;
+  };
+  s21::concurrent_vector<Picky> v;
+  v.emplace_back(1);
+  EXPECT_THROW(v.emplace_back(-1), std::invalid_argument);
+  v.emplace_back(2);
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[1].value, 0);
+  EXPECT_EQ(v[2].value, 2);
+}
@@ -1,4 +1,5 @@
 #include <list>
+#include <memory>
 
 #include "test_start.h"
 
@@ -304,3 +305,39 @@ TEST(ListTest, PopBackSingleElement) {
   EXPECT_EQ(l.size(), 0UL);
   EXPECT_TRUE(l.empty());
 }
+
+TEST(ListTest, MoveAssignBetweenAllocatorsMovesValues) {
+  using Alloc = alloc_tracker::counting_allocator<std::unique_ptr<int>>;
+  alloc_tracker::AllocStats stats_a;
+  alloc_tracker::AllocStats stats_b;
+  s21::list<std::unique_ptr<int>, Alloc> from{Alloc(&stats_a)};
+  for (int i = 0; i < 5; i++) {
+    from.push_back(std::make_unique<int>(i));
+  }
+  s21::list<std::unique_ptr<int>, Alloc> to{Alloc(&stats_b)};
+  // аллокаторы разные, узлы не забрать: значения переезжают в новые узлы
+  to = std::move(from);
+  EXPECT_TRUE(from.empty());
+  ASSERT_EQ(to.size(), 5UL);
+  EXPECT_EQ(*to.front(), 0);
+  EXPECT_EQ(*to.back(), 4);
+  EXPECT_EQ(stats_b.allocations, 5UL);
+}
+
+TEST(ListTest, CustomAllocator) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  {
+    s21::list<int, alloc_tracker::counting_allocator<int>> l(alloc);
+    for (int i = 0; i < 10; i++) {
+      l.push_back(i);
+    }
+    l.pop_front();
+    EXPECT_EQ(l.get_allocator(), alloc);
+    // каждый узел - отдельная аллокация через аллокатор списка
+    EXPECT_EQ(stats.allocations, 10UL);
+    EXPECT_EQ(stats.deallocations, 1UL);
+  }
+  EXPECT_EQ(stats.deallocations, 10UL);
+  EXPECT_EQ(stats.live_bytes, 0UL);
+}
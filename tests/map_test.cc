@@ -1,4 +1,5 @@
 #include <map>
+#include <memory>
 #include <stdio.h>
 #include "test_start.h"
 
@@ -456,3 +457,72 @@ TEST(MapTestTest, InsertKeyValueMultiple) {
     EXPECT_EQ(result.first.getNode()->value_, static_cast<int>(key));
   }
 }
+
+TEST(MapTest, CustomAllocator) {
+  using Alloc = alloc_tracker::counting_allocator<std::pair<const int, int>>;
+  alloc_tracker::AllocStats stats;
+  Alloc alloc(&stats);
+  {
+    s21::map<int, int, Alloc> myMap(alloc);
+    for (int i = 0; i < 10; i++) {
+      myMap.insert(i, i * i);
+    }
+    // дубликат создает узел и сразу возвращает его аллокатору
+    myMap.insert(3, 0);
+    myMap.erase(myMap.find(5));
+    EXPECT_EQ(myMap.get_allocator(), alloc);
+    EXPECT_EQ(stats.allocations, 11UL);
+    EXPECT_EQ(stats.deallocations, 2UL);
+
+    s21::map<int, int, Alloc> copy(myMap);
+    EXPECT_EQ(copy.size(), 9UL);
+    EXPECT_EQ(stats.allocations, 20UL);
+  }
+  EXPECT_EQ(stats.deallocations, stats.allocations);
+  EXPECT_EQ(stats.live_bytes, 0UL);
+}
+
+TEST(MapTest, MoveAssignBetweenAllocatorsMovesValues) {
+  using Alloc = alloc_tracker::counting_allocator<
+      std::pair<const int, std::unique_ptr<int>>>;
+  using map_type = s21::map<int, std::unique_ptr<int>, Alloc>;
+  alloc_tracker::AllocStats stats_a;
+  alloc_tracker::AllocStats stats_b;
+  map_type from{Alloc(&stats_a)};
+  int next_key = 0;
+  from.assign_sorted(10, [&next_key] {
+    int key = next_key++;
+    return std::make_pair(key, std::make_unique<int>(key * 10));
+  });
+  map_type to{Alloc(&stats_b)};
+  // аллокаторы разные: значения переезжают в узлы to, а не копируются
+  to = std::move(from);
+  EXPECT_TRUE(from.empty());
+  ASSERT_EQ(to.size(), 10UL);
+  EXPECT_EQ(*to.at(7), 70);
+  EXPECT_EQ(stats_b.allocations, 10UL);
+}
+
+TEST(MapTest, ConstIterators) {
+  using map_type = s21::map<int, int>;
+  static_assert(std::is_same<decltype(std::declval<const map_type &>().begin()),
+                             map_type::const_iterator>::value,
+                "a const map must not hand out mutable iterators");
+  static_assert(std::is_same<decltype(*std::declval<map_type::const_iterator>()),
+                             const int &>::value,
+                "const_iterator must dereference to a const value");
+  map_type m = {{3, 30}, {1, 10}, {2, 20}};
+  const map_type &cm = m;
+  int expected_key = 1;
+  for (auto it = cm.begin(); it != cm.end(); ++it) {
+    EXPECT_EQ(it->key_, expected_key);
+    EXPECT_EQ(*it, expected_key * 10);
+    expected_key++;
+  }
+  EXPECT_EQ(expected_key, 4);
+  // через неконстантный map значения по-прежнему меняются
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    *it += 1;
+  }
+  EXPECT_EQ(*m.cbegin(), 11);
+}
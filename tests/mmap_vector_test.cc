@@ -0,0 +1,172 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <system_error>
+
+#include "test_start.h"
+
+namespace {
+// Временный файл, который удаляется в конце теста
+class TempFile {
+ public:
+  TempFile() {
+    char name[] = "/tmp/s21_mmap_vector_XXXXXX";
+    int fd = ::mkstemp(name);
+    ::close(fd);
+    ::unlink(name);
+    path_ = name;
+  }
+  ~TempFile() { ::unlink(path_.c_str()); }
+  const std::string &path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+struct Point {
+  double x;
+  double y;
+};
+}  // namespace
+
+TEST(MmapVectorTest, CreateAndReopen) {
+  TempFile file;
+  {
+    s21::mmap_vector<std::int64_t> v(file.path());
+    EXPECT_TRUE(v.empty());
+    for (std::int64_t i = 0; i < 10000; i++) {
+      v.push_back(i * i);
+    }
+    EXPECT_GE(v.capacity(), 10000UL);
+  }
+  s21::mmap_vector<std::int64_t> v(file.path());
+  ASSERT_EQ(v.size(), 10000UL);
+  EXPECT_EQ(v[0], 0);
+  EXPECT_EQ(v[9999], 9999LL * 9999);
+  v.push_back(-1);
+  EXPECT_EQ(v.back(), -1);
+}
+
+TEST(MmapVectorTest, VectorInterface) {
+  TempFile file;
+  s21::mmap_vector<Point> v(file.path());
+  v.emplace_back(Point{1, 2});
+  v.resize(4, Point{3, 4});
+  v.insert(v.begin() + 1, Point{5, 6});
+  v.erase(v.begin() + 2, v.begin() + 4);
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v.front().x, 1);
+  EXPECT_EQ(v[1].y, 6);
+  EXPECT_EQ(v.at(2).x, 3);
+  EXPECT_THROW(v.at(3), std::out_of_range);
+  EXPECT_THROW(v.erase(v.begin() + 2, v.begin() + 4), std::out_of_range);
+
+  // аргумент ссылается на элемент, который переезжает при росте
+  v.shrink_to_fit();
+  std::size_t capacity = v.capacity();
+  for (std::size_t i = v.size(); i <= capacity; i++) {
+    v.push_back(v[0]);
+  }
+  EXPECT_EQ(v.back().x, 1);
+
+  s21::vector<Point> source;
+  source.assign(100, Point{7, 8});
+  v.assign(source.begin(), source.end());
+  EXPECT_EQ(v.size(), 100UL);
+  EXPECT_EQ(v[99].y, 8);
+  v.clear();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 0UL);
+}
+
+TEST(MmapVectorTest, ReadOnly) {
+  TempFile file;
+  {
+    s21::mmap_vector<int> v(file.path());
+    v.resize(1000, 5);
+  }
+  const s21::mmap_vector<int> v(file.path(), s21::mmap_mode::read_only);
+  EXPECT_EQ(v.size(), 1000UL);
+  EXPECT_EQ(v[999], 5);
+
+  s21::mmap_vector<int> w(file.path(), s21::mmap_mode::read_only);
+  EXPECT_THROW(w.push_back(1), std::logic_error);
+  EXPECT_THROW(w.pop_back(), std::logic_error);
+  EXPECT_THROW(w.resize(10), std::logic_error);
+  EXPECT_EQ(w.size(), 1000UL);
+}
+
+TEST(MmapVectorTest, CopyOnWriteLeavesFileIntact) {
+  TempFile file;
+  {
+    s21::mmap_vector<int> v(file.path());
+    v.resize(100, 1);
+  }
+  {
+    s21::mmap_vector<int> v(file.path(), s21::mmap_mode::copy_on_write);
+    v[0] = 42;
+    for (int i = 0; i < 5000; i++) {
+      v.push_back(i);
+    }
+    EXPECT_EQ(v[0], 42);
+    EXPECT_EQ(v[99], 1);
+    EXPECT_EQ(v.back(), 4999);
+    v.sync();
+  }
+  s21::mmap_vector<int> v(file.path(), s21::mmap_mode::read_only);
+  EXPECT_EQ(v.size(), 100UL);
+  EXPECT_EQ(v[0], 1);
+}
+
+TEST(MmapVectorTest, SyncPublishesSize) {
+  TempFile file;
+  s21::mmap_vector<int> writer(file.path());
+  writer.resize(10, 3);
+  writer.sync();
+  writer.push_back(4);
+  // второе отображение видит размер последней точки sync()
+  s21::mmap_vector<int> reader(file.path(), s21::mmap_mode::read_only);
+  EXPECT_EQ(reader.size(), 10UL);
+  writer.sync();
+  s21::mmap_vector<int> again(file.path(), s21::mmap_mode::read_only);
+  EXPECT_EQ(again.size(), 11UL);
+  EXPECT_EQ(again.back(), 4);
+}
+
+TEST(MmapVectorTest, Move) {
+  TempFile file;
+  s21::mmap_vector<int> a(file.path());
+  a.push_back(1);
+  s21::mmap_vector<int> b(std::move(a));
+  EXPECT_EQ(b.size(), 1UL);
+  EXPECT_EQ(a.size(), 0UL);
+  EXPECT_THROW(a.push_back(2), std::logic_error);
+  a = std::move(b);
+  EXPECT_EQ(a[0], 1);
+}
+
+TEST(MmapVectorTest, Errors) {
+  TempFile file;
+  EXPECT_THROW(s21::mmap_vector<int>(file.path(), s21::mmap_mode::read_only),
+               std::system_error);
+  {
+    s21::mmap_vector<std::int32_t> v(file.path());
+    v.push_back(1);
+  }
+  EXPECT_THROW(s21::mmap_vector<std::int64_t>(file.path()),
+               std::runtime_error);
+
+  TempFile other;
+  std::FILE *f = std::fopen(other.path().c_str(), "w");
+  std::fputs("not a vector", f);
+  std::fclose(f);
+  EXPECT_THROW(s21::mmap_vector<int>(other.path()), std::runtime_error);
+  // чужой файл остается нетронутым
+  f = std::fopen(other.path().c_str(), "r");
+  char buffer[32] = {};
+  EXPECT_NE(std::fgets(buffer, sizeof(buffer), f), nullptr);
+  std::fclose(f);
+  EXPECT_STREQ(buffer, "not a vector");
+}
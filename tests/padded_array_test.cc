@@ -0,0 +1,97 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+#include "test_start.h"
+
+namespace {
+template <typename Array>
+bool own_lines(const Array &a, std::size_t line) {
+  for (std::size_t i = 0; i < a.size(); i++) {
+    auto address = reinterpret_cast<std::uintptr_t>(&a[i]);
+    if (address % line != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+TEST(PaddedArrayTest, LayoutOneElementPerLine) {
+  s21::padded_array<std::uint64_t, 8> a;
+  EXPECT_EQ(alignof(decltype(a)), 64UL);
+  EXPECT_EQ(sizeof(a), 8 * 64UL);
+  EXPECT_TRUE(own_lines(a, 64));
+  EXPECT_EQ(reinterpret_cast<const char *>(&a[1]) -
+                reinterpret_cast<const char *>(&a[0]),
+            64);
+
+  // элемент больше строки занимает две
+  struct Big {
+    char bytes[100];
+  };
+  s21::padded_array<Big, 3> big;
+  EXPECT_EQ(sizeof(big), 3 * 128UL);
+  EXPECT_TRUE(own_lines(big, 64));
+
+  s21::padded_array<int, 4, 128> wide;
+  EXPECT_EQ(alignof(decltype(wide)), 128UL);
+  EXPECT_TRUE(own_lines(wide, 128));
+
+  // и в динамической памяти
+  auto heap = std::make_unique<s21::padded_array<std::uint64_t, 5>>();
+  EXPECT_TRUE(own_lines(*heap, 64));
+}
+
+TEST(PaddedArrayTest, ElementAccess) {
+  s21::padded_array<int, 5> a;
+  for (std::size_t i = 0; i < a.size(); i++) {
+    EXPECT_EQ(a[i], 0);
+    a[i] = static_cast<int>(i) * 10;
+  }
+  EXPECT_EQ(a.front(), 0);
+  EXPECT_EQ(a.back(), 40);
+  EXPECT_EQ(a.at(2), 20);
+  EXPECT_THROW(a.at(5), std::out_of_range);
+  EXPECT_EQ(std::accumulate(a.begin(), a.end(), 0), 100);
+  EXPECT_EQ(a.end() - a.begin(), 5);
+  EXPECT_EQ(a.begin()[3], 30);
+
+  const auto &ca = a;
+  s21::padded_array<int, 5>::const_iterator it = a.begin();
+  EXPECT_EQ(*(it + 1), 10);
+  EXPECT_EQ(ca.cend() - ca.cbegin(), 5);
+  a.fill(7);
+  EXPECT_EQ(ca[4], 7);
+  EXPECT_FALSE(a.empty());
+}
+
+TEST(PaddedArrayTest, PerThreadAtomicCounters) {
+  constexpr std::size_t kThreads = 4;
+  s21::padded_array<std::atomic<std::uint64_t>, kThreads> counters;
+  counters.fill(0);
+  s21::vector<std::thread> threads;
+  for (std::size_t t = 0; t < kThreads; t++) {
+    threads.push_back(std::thread([&counters, t] {
+      for (int i = 0; i < 10000; i++) {
+        counters[t].fetch_add(1, std::memory_order_relaxed);
+      }
+    }));
+  }
+  for (std::size_t t = 0; t < kThreads; t++) {
+    threads[t].join();
+  }
+  for (const auto &counter : counters) {
+    EXPECT_EQ(counter.load(), 10000UL);
+  }
+}
+
+#ifdef S21_HARDENED
+TEST(PaddedArrayTest, HardenedOperatorBracket) {
+  s21::padded_array<int, 3> a;
+  EXPECT_DEATH(a[3], "padded_array index out of range");
+}
+#endif
@@ -0,0 +1,166 @@
+#include "test_start.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace {
+// Свой пул на 3 фоновых потока, чтобы параллельный путь работал и на
+// одноядерной машине
+s21::parallel::thread_pool &test_pool() {
+  static s21::parallel::thread_pool pool(3);
+  return pool;
+}
+
+s21::vector<std::int64_t> shuffled(std::size_t n) {
+  s21::vector<std::int64_t> v(n);
+  std::uint64_t x = 88172645463325252ULL;
+  for (std::size_t i = 0; i < n; i++) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    v[i] = static_cast<std::int64_t>(x % 100000);
+  }
+  return v;
+}
+
+const std::size_t kSizes[] = {0, 1, 1000, S21_PARALLEL_THRESHOLD - 1,
+                              S21_PARALLEL_THRESHOLD, 200003};
+}  // namespace
+
+TEST(ParallelTest, Sort) {
+  for (std::size_t n : kSizes) {
+    s21::vector<std::int64_t> v = shuffled(n);
+    std::vector<std::int64_t> expected(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end());
+    s21::parallel::sort(v, std::less<>(), test_pool());
+    ASSERT_EQ(v.size(), expected.size());
+    for (std::size_t i = 0; i < n; i++) {
+      ASSERT_EQ(v[i], expected[i]) << "n = " << n << ", i = " << i;
+    }
+  }
+}
+
+TEST(ParallelTest, SortDescendingStrings) {
+  s21::vector<std::int64_t> numbers = shuffled(100000);
+  s21::vector<std::string> v(numbers.size());
+  for (std::size_t i = 0; i < v.size(); i++) {
+    v[i] = std::to_string(numbers[i]);
+  }
+  s21::parallel::sort(v, std::greater<>(), test_pool());
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<>()));
+}
+
+TEST(ParallelTest, Reduce) {
+  for (std::size_t n : kSizes) {
+    s21::vector<std::int64_t> v = shuffled(n);
+    std::int64_t expected = std::accumulate(v.begin(), v.end(),
+                                            std::int64_t(5));
+    EXPECT_EQ(s21::parallel::reduce(v, std::int64_t(5), std::plus<>(),
+                                    test_pool()),
+              expected);
+  }
+  s21::vector<std::int64_t> v = shuffled(100000);
+  EXPECT_EQ(s21::parallel::reduce(
+                v, std::int64_t(-1),
+                [](std::int64_t a, std::int64_t b) { return std::max(a, b); },
+                test_pool()),
+            *std::max_element(v.begin(), v.end()));
+}
+
+TEST(ParallelTest, TransformAndForEach) {
+  s21::vector<std::int64_t> v = shuffled(150000);
+  s21::vector<double> halves(v.size());
+  s21::parallel::transform(
+      v, halves, [](std::int64_t x) { return x / 2.0; }, test_pool());
+  s21::parallel::for_each(
+      v, [](std::int64_t &x) { x *= 3; }, test_pool());
+  for (std::size_t i = 0; i < v.size(); i++) {
+    ASSERT_EQ(halves[i] * 6, static_cast<double>(v[i]));
+  }
+
+  s21::vector<double> wrong(3);
+  EXPECT_THROW(s21::parallel::transform(
+                   v, wrong, [](std::int64_t x) { return x / 2.0; }),
+               std::invalid_argument);
+}
+
+TEST(ParallelTest, InclusiveScan) {
+  for (std::size_t n : kSizes) {
+    s21::vector<std::int64_t> v = shuffled(n);
+    std::vector<std::int64_t> expected(n);
+    std::partial_sum(v.begin(), v.end(), expected.begin());
+    s21::vector<std::int64_t> out(n);
+    s21::parallel::inclusive_scan(v, out, std::plus<>(), test_pool());
+    // на месте
+    s21::parallel::inclusive_scan(v, v, std::plus<>(), test_pool());
+    for (std::size_t i = 0; i < n; i++) {
+      ASSERT_EQ(out[i], expected[i]) << "n = " << n << ", i = " << i;
+      ASSERT_EQ(v[i], expected[i]);
+    }
+  }
+}
+
+TEST(ParallelTest, Array) {
+  s21::array<int, 5> arr = {5, 3, 1, 4, 2};
+  s21::parallel::sort(arr);
+  EXPECT_EQ(arr[0], 1);
+  EXPECT_EQ(arr[4], 5);
+  EXPECT_EQ(s21::parallel::reduce(arr, 0), 15);
+}
+
+TEST(ParallelTest, ExceptionPropagates) {
+  s21::vector<int> v(100000);
+  EXPECT_THROW(s21::parallel::for_each(
+                   v,
+                   [](int &x) {
+                     if (x == 0) {
+                       throw std::runtime_error("element failed");
+                     }
+                   },
+                   test_pool()),
+               std::runtime_error);
+}
+
+TEST(ParallelTest, NestedCallsDoNotDeadlock) {
+  s21::vector<s21::vector<std::int64_t>> rows(8);
+  for (auto &row : rows) {
+    row = shuffled(50000);
+  }
+  s21::parallel::for_each(
+      rows,
+      [](s21::vector<std::int64_t> &row) {
+        s21::parallel::sort(row, std::less<>(), test_pool());
+      },
+      test_pool());
+  for (auto &row : rows) {
+    EXPECT_TRUE(std::is_sorted(row.begin(), row.end()));
+  }
+}
+
+TEST(ParallelTest, TaskGroup) {
+  std::atomic<int> sum{0};
+  s21::parallel::task_group group(test_pool());
+  for (int i = 1; i <= 100; i++) {
+    group.run([&sum, i] { sum += i; });
+  }
+  group.wait();
+  EXPECT_EQ(sum.load(), 5050);
+}
+
+TEST(ParallelTest, BurstOfTasksDrains) {
+  // Задачи забираются потоками сразу после публикации; счетчик ожидающих
+  // не должен уходить ниже нуля, иначе пул не засыпает и не завершается
+  for (int round = 0; round < 20; round++) {
+    s21::parallel::thread_pool pool(4);
+    std::atomic<int> done{0};
+    s21::parallel::task_group group(pool);
+    for (int i = 0; i < 1000; i++) {
+      group.run([&done] { done++; });
+    }
+    group.wait();
+    EXPECT_EQ(done.load(), 1000);
+  }
+}
@@ -0,0 +1,140 @@
+#include "test_start.h"
+
+#include <cstdint>
+#include <string>
+
+TEST(PmrTest, MapFromMonotonicBufferDoesNotTouchHeap) {
+  alignas(std::max_align_t) char buffer[1 << 16];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  alloc_tracker::AllocScope scope;
+  {
+    s21::pmr::map<int, int> scratch(&arena);
+    for (int i = 0; i < 100; i++) {
+      scratch.insert(i, i * 2);
+    }
+    EXPECT_EQ(scratch.size(), 100UL);
+    EXPECT_EQ(scratch.at(42), 84);
+    EXPECT_EQ(scratch.get_allocator().resource(), &arena);
+  }
+  EXPECT_EQ(scope.stats().allocations, 0UL);
+}
+
+TEST(PmrTest, ListFromPoolResource) {
+  std::pmr::unsynchronized_pool_resource pool;
+  s21::pmr::list<int> l(&pool);
+  for (int i = 0; i < 10; i++) {
+    l.push_back(i);
+  }
+  EXPECT_EQ(l.get_allocator().resource(), &pool);
+  EXPECT_EQ(l.front(), 0);
+  EXPECT_EQ(l.back(), 9);
+}
+
+TEST(PmrTest, CopyUsesDefaultResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::vector<int> v({1, 2, 3}, &arena);
+  s21::pmr::vector<int> copy(v);
+  EXPECT_EQ(copy.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  EXPECT_EQ(copy[2], 3);
+
+  s21::pmr::vector<int> extended(v, &arena);
+  EXPECT_EQ(extended.get_allocator().resource(), &arena);
+  EXPECT_EQ(extended.size(), 3UL);
+}
+
+TEST(PmrTest, CopyAssignmentKeepsResource) {
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  s21::pmr::set<int> a({1, 2, 3}, &first);
+  s21::pmr::set<int> b(&second);
+  b = a;
+  EXPECT_EQ(b.get_allocator().resource(), &second);
+  EXPECT_EQ(b.size(), 3UL);
+  EXPECT_TRUE(b.contains(2));
+}
+
+TEST(PmrTest, MoveConstructionTakesResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::list<int> a({1, 2, 3}, &arena);
+  s21::pmr::list<int> b(std::move(a));
+  EXPECT_EQ(b.get_allocator().resource(), &arena);
+  EXPECT_EQ(b.size(), 3UL);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(PmrTest, MoveAssignmentBetweenResourcesMovesElements) {
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+
+  s21::pmr::vector<int> v1({1, 2, 3}, &first);
+  s21::pmr::vector<int> v2(&second);
+  v2 = std::move(v1);
+  EXPECT_EQ(v2.get_allocator().resource(), &second);
+  EXPECT_EQ(v2.size(), 3UL);
+  EXPECT_EQ(v2[1], 2);
+
+  s21::pmr::map<int, int> m1({{1, 1}, {2, 2}}, &first);
+  s21::pmr::map<int, int> m2(&second);
+  m2 = std::move(m1);
+  EXPECT_EQ(m2.get_allocator().resource(), &second);
+  EXPECT_EQ(m2.size(), 2UL);
+  EXPECT_TRUE(m1.empty());
+
+  s21::pmr::queue<int> q1({1, 2}, &first);
+  s21::pmr::queue<int> q2(&second);
+  q2 = std::move(q1);
+  EXPECT_EQ(q2.get_allocator().resource(), &second);
+  EXPECT_EQ(q2.back(), 2);
+
+  s21::pmr::stack<int> s1({1, 2}, &first);
+  s21::pmr::stack<int> s2(&second);
+  s2 = std::move(s1);
+  EXPECT_EQ(s2.get_allocator().resource(), &second);
+  EXPECT_EQ(s2.top(), 2);
+}
+
+TEST(PmrTest, MoveAssignmentSameResourceStealsMemory) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::vector<int> v1({1, 2, 3}, &arena);
+  const int *data = v1.data();
+  s21::pmr::vector<int> v2(&arena);
+  v2 = std::move(v1);
+  EXPECT_EQ(v2.data(), data);
+  EXPECT_TRUE(v1.empty());
+}
+
+TEST(PmrTest, SwapKeepsResources) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::list<int> a({1, 2}, &arena);
+  s21::pmr::list<int> b({3}, &arena);
+  a.swap(b);
+  EXPECT_EQ(a.get_allocator().resource(), &arena);
+  EXPECT_EQ(a.size(), 1UL);
+  EXPECT_EQ(b.size(), 2UL);
+}
+
+TEST(PmrTest, ElementsGetContainerResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::vector<std::pmr::string> v(2, &arena);
+  v[0] = "a string that does not fit into the small buffer";
+  EXPECT_EQ(v[0].get_allocator().resource(), &arena);
+}
+
+TEST(PmrTest, SoaVectorFromArena) {
+  alignas(std::max_align_t) char buffer[1 << 16];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  alloc_tracker::AllocScope scope;
+  {
+    s21::pmr::soa_vector<int, float> v(&arena);
+    for (int i = 0; i < 500; i++) {
+      v.emplace_back(i, i * 0.5f);
+    }
+    EXPECT_EQ(v.get_allocator().resource(), &arena);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data<1>()) % 64, 0UL);
+    EXPECT_EQ(std::get<0>(v[499]), 499);
+  }
+  EXPECT_EQ(scope.stats().allocations, 0UL);
+}
@@ -1,5 +1,6 @@
 #include "test_start.h"
 #include <queue>
+#include <string>
 
 TEST(QueueTest, Constructor_Default) {
   s21::queue<int> s21_queue;
@@ -122,4 +123,111 @@ TEST(QueueTest, BackAfterPush) {
     s21::queue<int> queueWithElement;
     queueWithElement.push(99);
     ASSERT_EQ(queueWithElement.back(), 99);
-}
\ No newline at end of file
+}
+TEST(QueueTest, CustomAllocator) {
+    alloc_tracker::AllocStats stats;
+    alloc_tracker::counting_allocator<int> alloc(&stats);
+    {
+        s21::queue<int, alloc_tracker::counting_allocator<int>> q(alloc);
+        q.push(1);
+        q.push(2);
+        q.pop();
+        q.push(3);
+        ASSERT_EQ(q.front(), 2);
+        ASSERT_EQ(q.back(), 3);
+        ASSERT_EQ(q.get_allocator(), alloc);
+        ASSERT_GT(stats.allocations, 0UL);
+    }
+    ASSERT_EQ(stats.deallocations, stats.allocations);
+    ASSERT_EQ(stats.live_bytes, 0UL);
+}
+
+TEST(QueueTest, WrapAround) {
+  s21::queue<int> q;
+  std::queue<int> expected;
+  int next = 0;
+  // Очередь держит 5..7 элементов и много раз проходит по кругу буфера
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 3; ++i) {
+      q.push(next);
+      expected.push(next++);
+    }
+    while (q.size() > 5) {
+      ASSERT_EQ(q.front(), expected.front());
+      q.pop();
+      expected.pop();
+    }
+  }
+  EXPECT_EQ(q.capacity(), 8UL);
+  EXPECT_EQ(q.back(), expected.back());
+}
+
+TEST(QueueTest, GrowWhileWrapped) {
+  s21::queue<int> q;
+  for (int i = 0; i < 8; ++i) {
+    q.push(i);
+  }
+  for (int i = 0; i < 5; ++i) {
+    q.pop();
+  }
+  // Элементы 5..7 в конце буфера, 8..12 - в начале, следующий push растит
+  for (int i = 8; i < 13; ++i) {
+    q.push(i);
+  }
+  EXPECT_EQ(q.capacity(), 8UL);
+  q.push(13);
+  EXPECT_EQ(q.capacity(), 16UL);
+  for (int i = 5; i < 14; ++i) {
+    ASSERT_EQ(q.front(), i);
+    q.pop();
+  }
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(QueueTest, PushFrontOfFullQueue) {
+  s21::queue<std::string> q;
+  for (int i = 0; i < 8; ++i) {
+    q.push(std::string(32, static_cast<char>('a' + i)));
+  }
+  // Аргумент ссылается на элемент самой очереди, а очередь растет
+  q.push(q.front());
+  EXPECT_EQ(q.size(), 9UL);
+  EXPECT_EQ(q.back(), std::string(32, 'a'));
+  EXPECT_EQ(q.front(), std::string(32, 'a'));
+}
+
+TEST(QueueTest, EmplaceAndMove) {
+  s21::queue<std::string> q;
+  std::string &ref = q.emplace(3, 'x');
+  EXPECT_EQ(ref, "xxx");
+  std::string moved(40, 'y');
+  q.push(std::move(moved));
+  EXPECT_EQ(q.back(), std::string(40, 'y'));
+  q.front() = "front";
+
+  s21::queue<std::string> copy(q);
+  s21::queue<std::string> stolen(std::move(q));
+  EXPECT_TRUE(q.empty());
+  ASSERT_EQ(stolen.size(), 2UL);
+  EXPECT_EQ(stolen.front(), "front");
+  copy.pop();
+  copy = stolen;
+  EXPECT_EQ(copy.size(), 2UL);
+  EXPECT_EQ(copy.front(), "front");
+}
+
+TEST(QueueTest, MillionPushesAllocateLogarithmically) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  s21::queue<int, alloc_tracker::counting_allocator<int>> q(alloc);
+  for (int i = 0; i < 1000000; ++i) {
+    q.push(i);
+    if (i % 2) {
+      q.pop();
+    }
+  }
+  // 500000 элементов: 8 -> 2^19, 17 удвоений
+  EXPECT_LE(stats.allocations, 20UL);
+  EXPECT_EQ(q.front(), 500000);
+  EXPECT_EQ(q.back(), 999999);
+}
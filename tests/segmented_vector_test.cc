@@ -0,0 +1,115 @@
+#include "test_start.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(SegmentedVectorTest, PushKeepsAddresses) {
+  s21::segmented_vector<int, 16> v;
+  v.push_back(0);
+  const int *first = &v[0];
+  std::vector<const int *> addresses;
+  for (int i = 1; i < 1000; i++) {
+    v.push_back(i);
+    addresses.push_back(&v.back());
+  }
+  EXPECT_EQ(first, &v[0]);
+  for (int i = 1; i < 1000; i++) {
+    ASSERT_EQ(addresses[i - 1], &v[i]);
+    ASSERT_EQ(*addresses[i - 1], i);
+  }
+  EXPECT_EQ(v.size(), 1000UL);
+  EXPECT_EQ(v.capacity(), 1008UL);
+}
+
+TEST(SegmentedVectorTest, GrowthDoesNotCopy) {
+  struct Counted {
+    explicit Counted(int *copies) : copies(copies) {}
+    Counted(const Counted &other) : copies(other.copies) { ++*copies; }
+    Counted(Counted &&other) : copies(other.copies) { ++*copies; }
+    int *copies;
+  };
+  int copies = 0;
+  s21::segmented_vector<Counted, 8> v;
+  for (int i = 0; i < 100; i++) {
+    v.emplace_back(&copies);
+  }
+  EXPECT_EQ(copies, 0);
+}
+
+TEST(SegmentedVectorTest, RandomAccessIterators) {
+  s21::segmented_vector<int, 4> v;
+  for (int i = 0; i < 50; i++) {
+    v.push_back((i * 37) % 50);
+  }
+  std::sort(v.begin(), v.end());
+  for (int i = 0; i < 50; i++) {
+    ASSERT_EQ(v[i], i);
+  }
+  auto it = std::lower_bound(v.begin(), v.end(), 23);
+  EXPECT_EQ(it - v.begin(), 23);
+  EXPECT_EQ(it[2], 25);
+  EXPECT_EQ(*(v.end() - 1), 49);
+
+  const auto &cv = v;
+  s21::segmented_vector<int, 4>::const_iterator cit = v.begin();
+  EXPECT_EQ(*cit, 0);
+  EXPECT_EQ(std::count_if(cv.begin(), cv.end(), [](int x) { return x < 10; }),
+            10);
+}
+
+TEST(SegmentedVectorTest, CopyMoveAndResize) {
+  s21::segmented_vector<std::string, 2> v = {"a", "b", "c"};
+  s21::segmented_vector<std::string, 2> copy(v);
+  EXPECT_EQ(copy.back(), "c");
+  s21::segmented_vector<std::string, 2> moved(std::move(v));
+  EXPECT_EQ(moved.size(), 3UL);
+  EXPECT_TRUE(v.empty());
+
+  copy.resize(5, "x");
+  EXPECT_EQ(copy[4], "x");
+  copy.resize(1);
+  EXPECT_EQ(copy.size(), 1UL);
+  copy.shrink_to_fit();
+  EXPECT_EQ(copy.capacity(), 2UL);
+
+  v = moved;
+  moved.clear();
+  EXPECT_EQ(v.at(1), "b");
+  EXPECT_THROW(v.at(3), std::out_of_range);
+  v.swap(moved);
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(moved.front(), "a");
+  v = std::move(moved);
+  EXPECT_EQ(v.size(), 3UL);
+}
+
+TEST(SegmentedVectorTest, ReserveAllocatesSegments) {
+  s21::segmented_vector<int, 64> v;
+  v.reserve(1000);
+  EXPECT_EQ(v.capacity(), 1024UL);
+  alloc_tracker::AllocScope scope;
+  for (int i = 0; i < 1024; i++) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(scope.stats().allocations, 0UL);
+}
+
+TEST(SegmentedVectorTest, PmrAllocator) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::segmented_vector<int, 8, std::pmr::polymorphic_allocator<int>> v(
+      &resource);
+  for (int i = 0; i < 100; i++) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(v[99], 99);
+  EXPECT_EQ(v.get_allocator().resource(), &resource);
+}
+
+#ifdef S21_HARDENED
+TEST(SegmentedVectorDeathTest, HardenedIndex) {
+  s21::segmented_vector<int> v(3);
+  EXPECT_DEATH(v[3], "segmented_vector index out of range");
+}
+#endif
@@ -0,0 +1,273 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include "test_start.h"
+
+namespace {
+struct Point {
+  double x;
+  double y;
+};
+
+// Временный файл, который удаляется в конце теста
+class TempFile {
+ public:
+  TempFile() {
+    char name[] = "/tmp/s21_serialize_XXXXXX";
+    fd_ = ::mkstemp(name);
+    path_ = name;
+  }
+  ~TempFile() {
+    ::close(fd_);
+    ::unlink(path_.c_str());
+  }
+  int fd() const { return fd_; }
+  void rewind() const { ::lseek(fd_, 0, SEEK_SET); }
+
+ private:
+  int fd_;
+  std::string path_;
+};
+}  // namespace
+
+TEST(SerializeTest, VectorRoundTrip) {
+  s21::vector<Point> source;
+  for (int i = 0; i < 1000; i++) {
+    source.push_back(Point{double(i), -double(i)});
+  }
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+  EXPECT_EQ(buffer.str().size(),
+            sizeof(s21::serial_header) + 1000 * sizeof(Point));
+
+  s21::vector<Point> loaded;
+  loaded.push_back(Point{7, 7});
+  s21::deserialize(buffer, loaded);
+  ASSERT_EQ(loaded.size(), 1000UL);
+  for (std::size_t i = 0; i < loaded.size(); i++) {
+    EXPECT_EQ(loaded[i].x, double(i));
+    EXPECT_EQ(loaded[i].y, -double(i));
+  }
+}
+
+TEST(SerializeTest, EmptyVector) {
+  s21::vector<int> source;
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+  s21::vector<int> loaded = {1, 2, 3};
+  s21::deserialize(buffer, loaded);
+  EXPECT_TRUE(loaded.empty());
+}
+
+TEST(SerializeTest, BitVectorRoundTrip) {
+  s21::vector<bool> source(1000, true);
+  for (std::size_t i = 0; i < source.size(); i += 3) {
+    source[i] = false;
+  }
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+  // 1000 битов - 16 слов по 8 байт
+  EXPECT_EQ(buffer.str().size(), sizeof(s21::serial_header) + 16 * 8);
+
+  s21::vector<bool> loaded = {true};
+  s21::deserialize(buffer, loaded);
+  EXPECT_EQ(loaded, source);
+  EXPECT_EQ(loaded.count(), source.count());
+
+  // байтовый вектор не читается как упакованный
+  std::stringstream bytes;
+  s21::serialize(bytes, s21::vector<char>(10));
+  EXPECT_THROW(s21::deserialize(bytes, loaded), std::runtime_error);
+  EXPECT_TRUE(loaded.empty());
+}
+
+TEST(SerializeTest, ArrayRoundTrip) {
+  s21::array<std::int32_t, 5> source = {5, 4, 3, 2, 1};
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+  s21::array<std::int32_t, 5> loaded;
+  s21::deserialize(buffer, loaded);
+  for (std::size_t i = 0; i < 5; i++) {
+    EXPECT_EQ(loaded[i], source[i]);
+  }
+
+  std::stringstream again;
+  s21::serialize(again, source);
+  s21::array<std::int32_t, 4> smaller;
+  EXPECT_THROW(s21::deserialize(again, smaller), std::runtime_error);
+}
+
+TEST(SerializeTest, SetRoundTrip) {
+  s21::set<int> source;
+  for (int i = 0; i < 100000; i++) {
+    source.insert((i * 7919) % 100003);
+  }
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+
+  s21::set<int> loaded = {-1, -2};
+  s21::deserialize(buffer, loaded);
+  ASSERT_EQ(loaded.size(), source.size());
+  auto expected = source.begin();
+  for (auto it = loaded.begin(); it != loaded.end(); ++it, ++expected) {
+    EXPECT_EQ(*it, *expected);
+  }
+  EXPECT_TRUE(loaded.contains(7919));
+  EXPECT_FALSE(loaded.contains(-1));
+  // дерево после загрузки остается рабочим
+  loaded.insert(-5);
+  loaded.erase(loaded.find(0));
+  EXPECT_EQ(*loaded.begin(), -5);
+  EXPECT_FALSE(loaded.contains(0));
+}
+
+TEST(SerializeTest, MapRoundTrip) {
+  s21::map<std::int64_t, Point> source;
+  for (std::int64_t i = 0; i < 5000; i++) {
+    source.insert(i * 3, Point{double(i), 0.5});
+  }
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+
+  s21::map<std::int64_t, Point> loaded;
+  s21::deserialize(buffer, loaded);
+  ASSERT_EQ(loaded.size(), 5000UL);
+  EXPECT_EQ(loaded.at(300).x, 100);
+  EXPECT_EQ(loaded.at(14997).y, 0.5);
+  EXPECT_FALSE(loaded.contains(1));
+  loaded.insert(1, Point{1, 1});
+  EXPECT_EQ(loaded.size(), 5001UL);
+}
+
+// Загруженное дерево - правильное красно-черное: корень черный, у красного
+// узла нет красных детей, черная высота всех путей одна
+TEST(SerializeTest, BuildSortedKeepsTreeInvariants) {
+  using tree_type = s21::RBTree<int, int>;
+  using node_type = tree_type::TreeNode;
+  for (int n : {0, 1, 2, 3, 4, 7, 8, 100, 1023, 1024, 1025}) {
+    tree_type tree;
+    int next = 0;
+    tree.buildSorted(n, [&next] {
+      next++;
+      return std::pair<int, int>(next, -next);
+    });
+    ASSERT_EQ(tree.size(), std::size_t(n));
+    if (n == 0) {
+      EXPECT_EQ(tree.root_, nullptr);
+      continue;
+    }
+    EXPECT_EQ(tree.root_->color_, tree_type::Color::BLACK);
+    int black_height = -1;
+    bool valid = true;
+    auto check = [&](auto &&self, const node_type *node, int blacks,
+                     const node_type *parent) -> void {
+      if (!node) {
+        if (black_height < 0) {
+          black_height = blacks;
+        }
+        valid = valid && blacks == black_height;
+        return;
+      }
+      valid = valid && node->parent_ == parent;
+      bool red = node->color_ == tree_type::Color::RED;
+      if (red && parent) {
+        valid = valid && parent->color_ == tree_type::Color::BLACK;
+      }
+      self(self, node->left_, blacks + !red, node);
+      self(self, node->right_, blacks + !red, node);
+    };
+    check(check, tree.root_, 0, nullptr);
+    EXPECT_TRUE(valid) << n;
+    int expected = 1;
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+      EXPECT_EQ(it->key_, expected++);
+    }
+  }
+}
+
+TEST(SerializeTest, FileDescriptorRoundTrip) {
+  TempFile file;
+  s21::vector<std::uint64_t> numbers;
+  for (std::uint64_t i = 0; i < 100000; i++) {
+    numbers.push_back(i * i);
+  }
+  s21::map<int, int> squares;
+  for (int i = 0; i < 20000; i++) {
+    squares.insert(i, i * i);
+  }
+  // два контейнера подряд в одном файле
+  s21::serialize(file.fd(), numbers);
+  s21::serialize(file.fd(), squares);
+  file.rewind();
+
+  s21::vector<std::uint64_t> loaded_numbers;
+  s21::map<int, int> loaded_squares;
+  s21::deserialize(file.fd(), loaded_numbers);
+  s21::deserialize(file.fd(), loaded_squares);
+  ASSERT_EQ(loaded_numbers.size(), numbers.size());
+  EXPECT_EQ(loaded_numbers[99999], 99999ULL * 99999);
+  ASSERT_EQ(loaded_squares.size(), 20000UL);
+  EXPECT_EQ(loaded_squares.at(19999), 19999 * 19999);
+  EXPECT_THROW(s21::deserialize(file.fd(), loaded_numbers),
+               std::runtime_error);
+  EXPECT_TRUE(loaded_numbers.empty());
+}
+
+TEST(SerializeTest, RejectsForeignData) {
+  s21::vector<int> ints = {1, 2, 3};
+  std::stringstream buffer;
+  s21::serialize(buffer, ints);
+  std::string bytes = buffer.str();
+
+  s21::vector<double> doubles;
+  std::stringstream wrong_size(bytes);
+  EXPECT_THROW(s21::deserialize(wrong_size, doubles), std::runtime_error);
+
+  s21::set<int> set;
+  std::stringstream wrong_kind(bytes);
+  EXPECT_THROW(s21::deserialize(wrong_kind, set), std::runtime_error);
+
+  std::string garbage = bytes;
+  garbage[0] = 'x';
+  std::stringstream bad_magic(garbage);
+  EXPECT_THROW(s21::deserialize(bad_magic, ints), std::runtime_error);
+
+  std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+  EXPECT_THROW(s21::deserialize(truncated, ints), std::runtime_error);
+  EXPECT_TRUE(ints.empty());
+}
+
+TEST(SerializeTest, RejectsUnsortedKeys) {
+  s21::set<int> source = {1, 2, 3};
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+  std::string bytes = buffer.str();
+  // меняем местами первый и второй ключ
+  std::swap_ranges(bytes.begin() + sizeof(s21::serial_header),
+                   bytes.begin() + sizeof(s21::serial_header) + sizeof(int),
+                   bytes.begin() + sizeof(s21::serial_header) + sizeof(int));
+  std::stringstream corrupted(bytes);
+  s21::set<int> loaded = {10};
+  EXPECT_THROW(s21::deserialize(corrupted, loaded), std::runtime_error);
+  EXPECT_TRUE(loaded.empty());
+}
+
+TEST(SerializeTest, TreeLoadAllocatesOnlyNodes) {
+  s21::set<int> source;
+  for (int i = 0; i < 10000; i++) {
+    source.insert(i);
+  }
+  std::stringstream buffer;
+  s21::serialize(buffer, source);
+  s21::set<int> loaded;
+  alloc_tracker::AllocScope scope;
+  s21::deserialize(buffer, loaded);
+  // узлы дерева и один блок чтения
+  EXPECT_EQ(scope.stats().allocations, 10001UL);
+}
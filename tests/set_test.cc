@@ -175,3 +175,20 @@ TEST(SetTest, Containsset) {
   EXPECT_EQ(my_set.contains(2), orig_set.contains(2));
   EXPECT_EQ(my_set.contains(2.1), orig_set.contains(2.1));
 }
+
+TEST(SetTest, CustomAllocator) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  {
+    s21::set<int, alloc_tracker::counting_allocator<int>> my_set(alloc);
+    for (int i = 0; i < 10; i++) {
+      my_set.insert(i);
+    }
+    EXPECT_EQ(my_set.get_allocator(), alloc);
+    EXPECT_EQ(stats.allocations, 10UL);
+    s21::set<int, alloc_tracker::counting_allocator<int>> copy(my_set);
+    EXPECT_EQ(copy.size(), 10UL);
+  }
+  EXPECT_EQ(stats.deallocations, stats.allocations);
+  EXPECT_EQ(stats.live_bytes, 0UL);
+}
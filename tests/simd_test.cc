@@ -0,0 +1,124 @@
+#include "test_start.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+
+namespace {
+// Прогоняет проверку на каждом наборе инструкций, который есть у процессора
+template <typename Check>
+void for_each_isa(Check check) {
+  s21::simd::isa best = s21::simd::best_isa();
+  for (s21::simd::isa isa :
+       {s21::simd::isa::scalar, s21::simd::isa::sse2, s21::simd::isa::avx2}) {
+    if (isa <= best) {
+      s21::simd::use_isa(isa);
+      SCOPED_TRACE(static_cast<int>(isa));
+      check();
+    }
+  }
+  s21::simd::use_isa(best);
+}
+
+template <typename T>
+s21::vector<T> sample(std::size_t n) {
+  s21::vector<T> v(n);
+  for (std::size_t i = 0; i < n; i++) {
+    v[i] = static_cast<T>((i * 37 + 11) % 101) - static_cast<T>(50);
+  }
+  return v;
+}
+
+template <typename T>
+void check_kernels() {
+  for_each_isa([] {
+    // размеры вокруг ширины векторов, чтобы задеть хвосты
+    for (std::size_t n : {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 33, 100, 1001}) {
+      s21::vector<T> v = sample<T>(n);
+      const T *first = v.data();
+      const T *last = v.data() + n;
+      T needle = n > 0 ? v[n * 2 / 3] : T(1);
+
+      EXPECT_EQ(s21::simd::find(v, needle), std::find(first, last, needle));
+      EXPECT_EQ(s21::simd::find(v, T(1000)), v.end());
+      EXPECT_EQ(s21::simd::count(v, needle),
+                static_cast<std::size_t>(std::count(first, last, needle)));
+      EXPECT_EQ(s21::simd::sum(v), std::accumulate(first, last, T(0)));
+      if (n > 0) {
+        EXPECT_EQ(s21::simd::min(v), *std::min_element(first, last));
+        EXPECT_EQ(s21::simd::max(v), *std::max_element(first, last));
+      }
+
+      s21::vector<T> doubled(n);
+      s21::simd::transform(v, doubled, [](T x) { return x * 2; });
+      s21::vector<T> total(n);
+      s21::simd::transform(v, doubled, total, [](T a, T b) { return a + b; });
+      for (std::size_t i = 0; i < n; i++) {
+        ASSERT_EQ(total[i], v[i] * 3);
+      }
+      s21::vector<T> product(n);
+      s21::simd::transform(v, total, product, std::multiplies<>());
+      s21::simd::transform(product, v, product, std::minus<T>());
+      s21::simd::transform(product, v, product, std::plus<>());
+      for (std::size_t i = 0; i < n; i++) {
+        ASSERT_EQ(product[i], v[i] * v[i] * 3);
+      }
+
+      s21::simd::fill(v, T(7));
+      EXPECT_EQ(std::count(first, last, T(7)), static_cast<long>(n));
+    }
+  });
+}
+}  // namespace
+
+TEST(SimdTest, Int32Kernels) { check_kernels<std::int32_t>(); }
+TEST(SimdTest, FloatKernels) { check_kernels<float>(); }
+TEST(SimdTest, DoubleKernels) { check_kernels<double>(); }
+TEST(SimdTest, OtherArithmeticTypes) { check_kernels<std::int64_t>(); }
+
+TEST(SimdTest, FindReturnsFirstMatch) {
+  for_each_isa([] {
+    s21::vector<std::int32_t> v(64);
+    v[40] = 5;
+    v[41] = 5;
+    v[63] = 5;
+    EXPECT_EQ(s21::simd::find(v, 5), v.begin() + 40);
+    EXPECT_EQ(s21::simd::count(v, 5), 3UL);
+  });
+}
+
+TEST(SimdTest, ArrayAndSmallVector) {
+  for_each_isa([] {
+    s21::array<double, 10> arr;
+    arr.fill(1.5);
+    EXPECT_EQ(s21::simd::sum(arr), 15.0);
+    arr[9] = -2.0;
+    EXPECT_EQ(s21::simd::min(arr), -2.0);
+    EXPECT_EQ(s21::simd::find(arr, -2.0), arr.begin() + 9);
+
+    s21::small_vector<float, 8> small = {1, 9, 3};
+    EXPECT_EQ(s21::simd::max(small), 9.0f);
+  });
+}
+
+TEST(SimdTest, NonNumericElements) {
+  s21::vector<std::string> words = {"b", "a", "c", "a"};
+  EXPECT_EQ(s21::simd::count(words, std::string("a")), 2UL);
+  EXPECT_EQ(s21::simd::min(words), "a");
+  EXPECT_EQ(s21::simd::sum(words), "baca");
+  s21::simd::fill(words, std::string("z"));
+  EXPECT_EQ(words[3], "z");
+}
+
+TEST(SimdTest, Errors) {
+  s21::vector<double> empty;
+  EXPECT_THROW(s21::simd::min(empty), std::out_of_range);
+  EXPECT_THROW(s21::simd::max(empty), std::out_of_range);
+  EXPECT_EQ(s21::simd::sum(empty), 0.0);
+
+  s21::vector<double> a(3), b(4);
+  EXPECT_THROW(s21::simd::transform(a, b, [](double x) { return x; }),
+               std::invalid_argument);
+}
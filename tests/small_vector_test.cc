@@ -0,0 +1,170 @@
+#include "test_start.h"
+
+#include <string>
+
+TEST(SmallVectorTest, StaysInline) {
+  alloc_tracker::AllocScope scope;
+  s21::small_vector<int, 4> v;
+  for (int i = 0; i < 4; i++) {
+    v.push_back(i);
+  }
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4UL);
+  EXPECT_EQ(v[3], 3);
+  EXPECT_EQ(scope.stats().allocations, 0UL);
+}
+
+TEST(SmallVectorTest, SpillsToHeap) {
+  s21::small_vector<std::string, 2> v = {"a", "b"};
+  alloc_tracker::AllocScope scope;
+  v.push_back("c");
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(scope.stats().allocations, 1UL);
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[2], "c");
+
+  v.erase(v.begin(), v.begin() + 2);
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.front(), "c");
+}
+
+TEST(SmallVectorTest, MoveInline) {
+  s21::small_vector<std::string, 4> a = {"x", "y"};
+  s21::small_vector<std::string, 4> b(std::move(a));
+  EXPECT_TRUE(b.is_inline());
+  EXPECT_EQ(b.size(), 2UL);
+  EXPECT_EQ(b[1], "y");
+  EXPECT_TRUE(a.empty());
+
+  s21::small_vector<int, 4> ints = {1, 2, 3};
+  s21::small_vector<int, 4> moved;
+  moved = std::move(ints);
+  EXPECT_EQ(moved.size(), 3UL);
+  EXPECT_EQ(moved[2], 3);
+  EXPECT_TRUE(ints.empty());
+}
+
+TEST(SmallVectorTest, MoveHeapStealsBuffer) {
+  s21::small_vector<int, 2> a = {1, 2, 3, 4};
+  const int *data = a.data();
+  s21::small_vector<int, 2> b(std::move(a));
+  EXPECT_EQ(b.data(), data);
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_TRUE(a.empty());
+  a.push_back(5);
+  EXPECT_EQ(a[0], 5);
+}
+
+TEST(SmallVectorTest, CopyAndSwap) {
+  s21::small_vector<std::string, 2> small = {"a"};
+  s21::small_vector<std::string, 2> big = {"b", "c", "d"};
+  s21::small_vector<std::string, 2> copy(big);
+  EXPECT_EQ(copy.size(), 3UL);
+  EXPECT_EQ(copy[2], "d");
+
+  small.swap(big);
+  EXPECT_EQ(small.size(), 3UL);
+  EXPECT_EQ(big.size(), 1UL);
+  EXPECT_EQ(big[0], "a");
+  EXPECT_TRUE(big.is_inline());
+
+  copy = big;
+  EXPECT_EQ(copy.size(), 1UL);
+  EXPECT_EQ(copy[0], "a");
+}
+
+TEST(SmallVectorTest, SameInterfaceAsVector) {
+  s21::small_vector<int, 4> v;
+  v.insert_many_back(1, 2, 3);
+  v.insert(v.begin() + 1, 2, 9);
+  v.insert_many(v.begin(), 0);
+  v.emplace(v.end(), 7);
+  v.erase(v.begin() + 2);
+  std::vector<int> expected = {0, 1, 9, 2, 3, 7};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(v[i], expected[i]);
+  }
+  v.resize(2);
+  v.assign(3, 4);
+  EXPECT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v.at(2), 4);
+  EXPECT_THROW(v.at(3), std::out_of_range);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(SmallVectorTest, ElementsDestroyed) {
+  alloc_tracker::AllocScope scope;
+  {
+    s21::small_vector<std::string, 2> v;
+    for (int i = 0; i < 10; i++) {
+      v.push_back("a string long enough to live on the heap " +
+                  std::to_string(i));
+    }
+    s21::small_vector<std::string, 2> other = {"short"};
+    other = std::move(v);
+    EXPECT_EQ(other.size(), 10UL);
+  }
+  EXPECT_EQ(scope.stats().live_bytes, 0UL);
+}
+
+TEST(SmallVectorTest, CustomAllocator) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  {
+    s21::small_vector<int, 4, alloc_tracker::counting_allocator<int>> v(
+        alloc);
+    v.assign({1, 2, 3});
+    EXPECT_EQ(stats.allocations, 0UL);
+    v.assign({1, 2, 3, 4, 5});
+    EXPECT_EQ(stats.allocations, 1UL);
+  }
+  EXPECT_EQ(stats.deallocations, 1UL);
+}
+
+TEST(SmallVectorTest, ReallocatingAllocator) {
+  // realloc разрешен только между буферами в куче, внутренний буфер
+  // аллокатору не отдается
+  s21::small_vector<int, 4, s21::malloc_allocator<int>> v = {0, 1, 2};
+  for (int i = 3; i < 1000; ++i) {
+    v.push_back(i);
+  }
+  ASSERT_EQ(v.size(), 1000UL);
+  EXPECT_EQ(v[999], 999);
+  v.erase(v.begin() + 2, v.end());
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  v.reserve(64);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v[1], 1);
+}
+
+TEST(SmallVectorTest, MiddleInsertOfThrowingMoveKeepsCapacity) {
+  struct Copyable {
+    Copyable(int x) : value(x) {}
+    Copyable(const Copyable &other) : value(other.value) {}
+    int value;
+  };
+  s21::small_vector<Copyable, 8> v = {1, 2};
+  for (int i = 0; i < 6; i++) {
+    v.insert(v.begin() + 1, Copyable(i));
+  }
+  EXPECT_EQ(v.capacity(), 8UL);
+  for (int i = 0; i < 40; i++) {
+    v.insert(v.begin() + 1, Copyable(i));
+  }
+  EXPECT_LE(v.capacity(), 64UL);
+  EXPECT_EQ(v.size(), 48UL);
+  EXPECT_EQ(v[1].value, 39);
+  EXPECT_EQ(v[47].value, 2);
+}
+
+#ifdef S21_HARDENED
+TEST(SmallVectorTest, HardenedOperatorBracket) {
+  s21::small_vector<int, 2> v = {1, 2};
+  EXPECT_DEATH(v[2], "vector index out of range");
+}
+#endif
@@ -0,0 +1,165 @@
+#include "test_start.h"
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+TEST(SoaVectorTest, PushAndRowAccess) {
+  s21::soa_vector<float, int, std::string> v;
+  v.push_back({1.5f, 7, "seven"});
+  v.push_back(std::make_tuple(2.5f, 8, std::string("eight")));
+  v.emplace_back(3.5f, 9, "nine");
+  ASSERT_EQ(v.size(), 3UL);
+
+  auto [x, id, name] = v[1];
+  EXPECT_EQ(x, 2.5f);
+  EXPECT_EQ(id, 8);
+  EXPECT_EQ(name, "eight");
+  // строка - ссылки на поля
+  id = 80;
+  std::get<2>(v[2]) = "NINE";
+  EXPECT_EQ(std::get<1>(v[1]), 80);
+  EXPECT_EQ(std::get<2>(v.back()), "NINE");
+
+  v[0] = std::make_tuple(0.5f, 6, std::string("six"));
+  std::tuple<float, int, std::string> copy = v.at(0);
+  EXPECT_EQ(copy, std::make_tuple(0.5f, 6, std::string("six")));
+  EXPECT_THROW(v.at(3), std::out_of_range);
+}
+
+TEST(SoaVectorTest, ColumnsAreAlignedAndContiguous) {
+  s21::soa_vector<double, std::int8_t, float> v;
+  for (int i = 0; i < 1000; i++) {
+    v.emplace_back(i * 0.5, static_cast<std::int8_t>(i % 100), i * 2.0f);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data<0>()) % 64, 0UL);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data<1>()) % 64, 0UL);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data<2>()) % 64, 0UL);
+  }
+  auto xs = v.column<0>();
+  ASSERT_EQ(xs.size(), 1000UL);
+  EXPECT_EQ(xs[999], 499.5);
+  EXPECT_EQ(s21::simd::sum(v.column<2>()), 999000.0f);
+  EXPECT_EQ(s21::simd::max(v.column<1>()), 99);
+  s21::simd::fill(xs, 1.0);
+  EXPECT_EQ(std::get<0>(v[500]), 1.0);
+
+  const auto &cv = v;
+  double total = 0;
+  for (double x : cv.column<0>()) {
+    total += x;
+  }
+  EXPECT_EQ(total, 1000.0);
+}
+
+TEST(SoaVectorTest, GrowthKeepsRows) {
+  s21::soa_vector<std::string, int> v;
+  alloc_tracker::AllocScope scope;
+  for (int i = 0; i < 100; i++) {
+    v.emplace_back(std::to_string(i) + " is long enough to avoid SSO", i);
+  }
+  // один блок на все столбцы при каждом росте
+  EXPECT_LE(scope.stats().allocations, 100UL + 8);
+  // аргумент ссылается на строку, которая переедет при росте
+  v.shrink_to_fit();
+  v.emplace_back(std::get<0>(v[0]), std::get<1>(v[0]));
+  EXPECT_EQ(std::get<0>(v.back()), "0 is long enough to avoid SSO");
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(std::get<1>(v[i]), i);
+  }
+}
+
+TEST(SoaVectorTest, CopyMoveResize) {
+  s21::soa_vector<int, std::string> v = {{1, "a"}, {2, "b"}};
+  s21::soa_vector<int, std::string> copy(v);
+  EXPECT_EQ(std::get<1>(copy[1]), "b");
+  s21::soa_vector<int, std::string> moved(std::move(v));
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(moved.size(), 2UL);
+  v = copy;
+  EXPECT_EQ(std::get<0>(v.front()), 1);
+
+  v.resize(4);
+  EXPECT_EQ(std::get<0>(v[3]), 0);
+  EXPECT_EQ(std::get<1>(v[3]), "");
+  v.resize(1);
+  v.pop_back();
+  EXPECT_TRUE(v.empty());
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 0UL);
+  moved = std::move(copy);
+  EXPECT_EQ(moved.size(), 2UL);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(SoaVectorTest, RowIterators) {
+  s21::soa_vector<int, char> v = {{1, 'a'}, {2, 'b'}, {3, 'c'}};
+  int sum = 0;
+  std::string letters;
+  for (auto [number, letter] : v) {
+    sum += number;
+    letters += letter;
+    number *= 10;
+  }
+  EXPECT_EQ(sum, 6);
+  EXPECT_EQ(letters, "abc");
+  EXPECT_EQ(std::get<0>(*(v.end() - 1)), 30);
+  s21::soa_vector<int, char>::const_iterator it = v.begin();
+  EXPECT_EQ(std::get<1>(it[1]), 'b');
+  EXPECT_EQ(v.end() - it, 3);
+}
+
+TEST(SoaVectorTest, FailedRowLeavesVectorIntact) {
+  struct Fragile {
+    explicit Fragile(int x) : value(x) {
+      if (x < 0) {
+        throw std::invalid_argument("negative");
+      }
+    }
+    int value;
+  };
+  s21::soa_vector<std::string, Fragile> v;
+  v.emplace_back("ok", 1);
+  v.reserve(4);
+  EXPECT_THROW(v.emplace_back("not ok", -1), std::invalid_argument);
+  ASSERT_EQ(v.size(), 1UL);
+  EXPECT_EQ(std::get<0>(v[0]), "ok");
+}
+
+TEST(SoaVectorTest, CustomAllocator) {
+  alloc_tracker::AllocStats stats;
+  using allocator = alloc_tracker::counting_allocator<std::byte>;
+  allocator alloc(&stats);
+  {
+    s21::basic_soa_vector<allocator, double, std::string> v(alloc);
+    for (int i = 0; i < 100; i++) {
+      v.emplace_back(i, std::to_string(i));
+      // counting_allocator выравнивает только на max_align_t
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data<0>()) % 64, 0UL);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data<1>()) % 64, 0UL);
+    }
+    EXPECT_EQ(v.get_allocator(), alloc);
+    size_t grown = stats.allocations;
+    EXPECT_GT(grown, 0UL);
+
+    s21::basic_soa_vector<allocator, double, std::string> copy(v);
+    EXPECT_EQ(std::get<1>(copy[42]), "42");
+    s21::basic_soa_vector<allocator, double, std::string> moved(
+        std::move(copy));
+    // перемещение забирает блок без новых аллокаций
+    EXPECT_EQ(stats.allocations, grown + 1);
+    EXPECT_EQ(std::get<0>(moved[99]), 99.0);
+
+    alloc_tracker::AllocStats other_stats;
+    s21::basic_soa_vector<allocator, double, std::string> other{
+        allocator(&other_stats)};
+    other = std::move(moved);
+    EXPECT_EQ(std::get<1>(other[7]), "7");
+    EXPECT_GT(other_stats.allocations, 0UL);
+    other.clear();
+    other.shrink_to_fit();
+    EXPECT_EQ(other_stats.live_bytes, 0UL);
+  }
+  EXPECT_EQ(stats.live_bytes, 0UL);
+  EXPECT_EQ(stats.allocations, stats.deallocations);
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "test_start.h"
+
+namespace {
+// Функция конвейера: принимает любой непрерывный кусок без копирования
+int sum(s21::span<const int> items) {
+  return std::accumulate(items.begin(), items.end(), 0);
+}
+}  // namespace
+
+TEST(SpanTest, FromContainersAndPointers) {
+  s21::vector<int> v = {1, 2, 3, 4, 5};
+  s21::array<int, 3> a = {10, 20, 30};
+  int raw[4] = {7, 8, 9, 10};
+
+  s21::span vs(v);
+  EXPECT_EQ(vs.data(), v.data());
+  EXPECT_EQ(vs.size(), 5UL);
+  EXPECT_EQ(vs.size_bytes(), 5 * sizeof(int));
+  EXPECT_EQ(sum(v), 15);
+  EXPECT_EQ(sum(a), 60);
+  EXPECT_EQ(sum(raw), 34);
+  EXPECT_EQ(sum(s21::span<const int>(raw + 1, 2)), 17);
+  EXPECT_EQ(sum(s21::span<const int>(raw, raw + 3)), 24);
+
+  const s21::vector<int> &cv = v;
+  s21::span cs(cv);
+  static_assert(std::is_same<decltype(cs), s21::span<const int>>::value);
+  EXPECT_TRUE(s21::span<int>().empty());
+}
+
+TEST(SpanTest, WritesThroughToOwner) {
+  s21::vector<int> v = {1, 2, 3, 4, 5};
+  s21::span<int> s(v);
+  s[0] = 100;
+  s.back() = 500;
+  for (int &x : s.subspan(1, 3)) {
+    x *= -1;
+  }
+  EXPECT_EQ(v[0], 100);
+  EXPECT_EQ(v[2], -3);
+  EXPECT_EQ(v[4], 500);
+  EXPECT_THROW(s.at(5), std::out_of_range);
+}
+
+TEST(SpanTest, SubRanges) {
+  s21::vector<int> v;
+  for (int i = 0; i < 10; i++) {
+    v.push_back(i);
+  }
+  s21::span<int> s(v);
+  EXPECT_EQ(s.first(3).back(), 2);
+  EXPECT_EQ(s.last(3).front(), 7);
+  EXPECT_EQ(s.subspan(4).size(), 6UL);
+  EXPECT_EQ(s.subspan(4).front(), 4);
+  EXPECT_EQ(s.subspan(2, 2)[1], 3);
+  EXPECT_TRUE(s.subspan(10).empty());
+  EXPECT_THROW(s.first(11), std::out_of_range);
+  EXPECT_THROW(s.last(11), std::out_of_range);
+  EXPECT_THROW(s.subspan(11), std::out_of_range);
+  EXPECT_THROW(s.subspan(8, 3), std::out_of_range);
+  EXPECT_EQ(*s.rbegin(), 9);
+}
+
+TEST(SpanTest, WorksWithAlgorithms) {
+  s21::vector<float> v;
+  for (int i = 0; i < 100; i++) {
+    v.push_back(float(100 - i));
+  }
+  // подотрезок отдается алгоритмам s21 без копии
+  EXPECT_EQ(s21::simd::sum(s21::span(v).first(10)), 955.f);
+  s21::simd::fill(s21::span(v).last(10), 0.f);
+  EXPECT_EQ(v[89], 11.f);
+  EXPECT_EQ(v[90], 0.f);
+  s21::parallel::sort(s21::span(v).first(50));
+  EXPECT_TRUE(std::is_sorted(v.data(), v.data() + 50));
+  EXPECT_EQ(v[50], 50.f);
+  s21::parallel::transform(s21::span(v).first(5), s21::span(v).last(5),
+                           [](float x) { return x * 2; });
+  EXPECT_EQ(v[95], 102.f);
+}
+
+TEST(StridedViewTest, MatrixColumn) {
+  const std::size_t rows = 4;
+  const std::size_t cols = 3;
+  s21::vector<int> matrix;
+  for (std::size_t i = 0; i < rows * cols; i++) {
+    matrix.push_back(int(i));
+  }
+  s21::strided_view<int> column{s21::span(matrix).subspan(1), cols};
+  ASSERT_EQ(column.size(), rows);
+  EXPECT_EQ(column.stride(), cols);
+  EXPECT_EQ(column[0], 1);
+  EXPECT_EQ(column[3], 10);
+  EXPECT_EQ(column.back(), 10);
+  EXPECT_EQ(std::accumulate(column.begin(), column.end(), 0), 1 + 4 + 7 + 10);
+
+  std::reverse(column.begin(), column.end());
+  EXPECT_EQ(matrix[1], 10);
+  EXPECT_EQ(matrix[10], 1);
+  std::sort(column.begin(), column.end());
+  EXPECT_EQ(matrix[1], 1);
+  EXPECT_EQ(matrix[0], 0);  // соседние столбцы не тронуты
+  EXPECT_EQ(column.end() - column.begin(), 4);
+}
+
+TEST(StridedViewTest, SubRangesAndConstruction) {
+  s21::array<int, 7> a = {0, 1, 2, 3, 4, 5, 6};
+  s21::strided_view evens(a, 2);
+  ASSERT_EQ(evens.size(), 4UL);
+  EXPECT_EQ(evens.last(1)[0], 6);
+  EXPECT_EQ(evens.first(2).back(), 2);
+  EXPECT_EQ(evens.subspan(1, 2)[1], 4);
+  EXPECT_EQ(evens.subspan(1).size(), 3UL);
+  EXPECT_THROW(evens.subspan(5), std::out_of_range);
+  EXPECT_THROW(evens.at(4), std::out_of_range);
+  EXPECT_THROW(s21::strided_view<int>(a.data(), 3, 0), std::invalid_argument);
+
+  s21::strided_view<const int> read_only = evens;
+  EXPECT_EQ(read_only[3], 6);
+  s21::vector<int> v = {1, 2, 3};
+  s21::strided_view every_third(v, 3);
+  EXPECT_EQ(every_third.size(), 1UL);
+}
@@ -1,5 +1,6 @@
 #include "test_start.h"
 #include <stack>
+#include <string>
 
 TEST(StackTest, Constructor_Default) {
   s21::stack<int> s21_stack;
@@ -71,3 +72,86 @@ TEST(StackTest, CopyConstructor_NonEmptyStack) {
     std_stack2.pop();
   }
 }
+
+TEST(StackTest, CustomAllocator) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  {
+    s21::stack<int, alloc_tracker::counting_allocator<int>> s(alloc);
+    s.push(1);
+    s.push(2);
+    s.pop();
+    s.push(3);
+    EXPECT_EQ(s.top(), 3);
+    EXPECT_EQ(s.get_allocator(), alloc);
+    EXPECT_GT(stats.allocations, 0UL);
+  }
+  EXPECT_EQ(stats.deallocations, stats.allocations);
+  EXPECT_EQ(stats.live_bytes, 0UL);
+}
+
+TEST(StackTest, MillionPushesAllocateLogarithmically) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  s21::stack<int, alloc_tracker::counting_allocator<int>> s(alloc);
+  for (int i = 0; i < 1000000; ++i) {
+    s.push(i);
+  }
+  EXPECT_LE(stats.allocations, 25UL);
+  EXPECT_GE(s.capacity(), s.size());
+  for (int i = 999999; i >= 0; --i) {
+    ASSERT_EQ(s.top(), i);
+    s.pop();
+  }
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(StackTest, ReserveAvoidsReallocation) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  s21::stack<int, alloc_tracker::counting_allocator<int>> s(alloc);
+  s.reserve(1000);
+  size_t after_reserve = stats.allocations;
+  for (int i = 0; i < 1000; ++i) {
+    s.push(i);
+  }
+  EXPECT_EQ(stats.allocations, after_reserve);
+  EXPECT_EQ(s.capacity(), 1000UL);
+}
+
+TEST(StackTest, EmplaceAndMovePush) {
+  s21::stack<std::string> s;
+  std::string &ref = s.emplace(3, 'x');
+  EXPECT_EQ(ref, "xxx");
+  std::string moved(40, 'y');
+  s.push(std::move(moved));
+  EXPECT_EQ(s.top(), std::string(40, 'y'));
+  s.top() = "top";
+  // аргумент ссылается на вершину самого стека
+  s.push(s.top());
+  EXPECT_EQ(s.size(), 3UL);
+
+  const s21::stack<std::string> copy(s);
+  EXPECT_EQ(copy.top(), "top");
+  s21::stack<std::string> stolen(std::move(s));
+  EXPECT_EQ(stolen.size(), 3UL);
+  stolen.pop();
+  stolen.pop();
+  EXPECT_EQ(stolen.top(), "xxx");
+}
+
+TEST(StackTest, PackedBool) {
+  s21::stack<bool> s;
+  for (int i = 0; i < 200; ++i) {
+    s.push(i % 3 == 0);
+  }
+  s.emplace(true) = false;
+  EXPECT_FALSE(s.top());
+  s.pop();
+  s.top() = false;
+  const s21::stack<bool> &cs = s;
+  EXPECT_FALSE(cs.top());
+  EXPECT_EQ(cs.size(), 200UL);
+  s.pop();
+  EXPECT_TRUE(s.top());
+}
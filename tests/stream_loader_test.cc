@@ -0,0 +1,153 @@
+#include <unistd.h>
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include "test_start.h"
+
+namespace {
+// Временный файл с заданным содержимым, удаляется в конце теста
+class TempFile {
+ public:
+  explicit TempFile(const std::string &content) {
+    char name[] = "/tmp/s21_stream_loader_XXXXXX";
+    ::close(::mkstemp(name));
+    path_ = name;
+    std::ofstream(path_, std::ios::binary) << content;
+  }
+  ~TempFile() { ::unlink(path_.c_str()); }
+  const std::string &path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+struct Tick {
+  std::int32_t id;
+  float price;
+};
+
+std::optional<std::pair<int, int>> parse_pair(std::string_view line) {
+  std::pair<int, int> result;
+  const char *end = line.data() + line.size();
+  auto first = std::from_chars(line.data(), end, result.first);
+  if (first.ec != std::errc() || first.ptr == end || *first.ptr != ',') {
+    return std::nullopt;
+  }
+  std::from_chars(first.ptr + 1, end, result.second);
+  return result;
+}
+
+std::string numbered_lines(int n) {
+  std::string content = "key,value\n";
+  for (int i = 0; i < n; i++) {
+    content += std::to_string(i) + "," + std::to_string(i * 2) + "\n";
+  }
+  return content;
+}
+}  // namespace
+
+TEST(StreamLoaderTest, SplitsLinesAcrossSmallBuffers) {
+  TempFile file("first\r\n\nsecond line is longer than the buffer\nlast");
+  for (bool use_mmap : {false, true}) {
+    s21::stream_options options;
+    options.buffer_bytes = 7;
+    options.use_mmap = use_mmap;
+    s21::vector<std::string> lines;
+    s21::for_each_line(
+        file.path(),
+        [&lines](std::string_view line) { lines.push_back(std::string(line)); },
+        options);
+    ASSERT_EQ(lines.size(), 4UL);
+    EXPECT_EQ(lines[0], "first");
+    EXPECT_EQ(lines[1], "");
+    EXPECT_EQ(lines[2], "second line is longer than the buffer");
+    EXPECT_EQ(lines[3], "last");
+  }
+}
+
+TEST(StreamLoaderTest, LoadLinesIntoVector) {
+  TempFile file(numbered_lines(10000));
+  s21::stream_options options;
+  options.buffer_bytes = 4096;
+  options.batch_size = 100;
+  s21::vector<std::pair<int, int>> v;
+  // заголовок CSV разборщик пропускает
+  EXPECT_EQ(s21::load_lines(file.path(), v, parse_pair, options), 10000UL);
+  ASSERT_EQ(v.size(), 10000UL);
+  EXPECT_EQ(v[0].first, 0);
+  EXPECT_EQ(v[9999].second, 19998);
+}
+
+TEST(StreamLoaderTest, LoadLinesIntoMapWithMmap) {
+  TempFile file(numbered_lines(5000));
+  s21::stream_options options;
+  options.use_mmap = true;
+  options.buffer_bytes = 1;  // округляется до страницы
+  s21::map<int, int> m;
+  EXPECT_EQ(s21::load_lines(file.path(), m, parse_pair, options), 5000UL);
+  EXPECT_EQ(m.size(), 5000UL);
+  EXPECT_EQ(m.at(4321), 8642);
+}
+
+TEST(StreamLoaderTest, LoadRecords) {
+  s21::vector<Tick> source;
+  for (int i = 0; i < 1000; i++) {
+    source.push_back(Tick{i, i * 0.5f});
+  }
+  TempFile file(std::string(reinterpret_cast<const char *>(source.data()),
+                            source.size() * sizeof(Tick)));
+  for (bool use_mmap : {false, true}) {
+    s21::stream_options options;
+    options.buffer_bytes = 4096 + 3;  // записи режутся границами блоков
+    options.use_mmap = use_mmap;
+    s21::vector<Tick> ticks;
+    EXPECT_EQ(s21::load_records<Tick>(file.path(), ticks, options), 1000UL);
+    ASSERT_EQ(ticks.size(), 1000UL);
+    EXPECT_EQ(ticks[777].id, 777);
+    EXPECT_EQ(ticks[777].price, 388.5f);
+
+    s21::set<std::int32_t> ids;
+    s21::load_records<Tick>(
+        file.path(), ids, [](const Tick &tick) { return tick.id; }, options);
+    EXPECT_EQ(ids.size(), 1000UL);
+  }
+}
+
+TEST(StreamLoaderTest, TruncatedRecordThrows) {
+  TempFile file(std::string(sizeof(Tick) * 3 + 1, '\0'));
+  s21::vector<Tick> ticks;
+  EXPECT_THROW(s21::load_records<Tick>(file.path(), ticks), std::runtime_error);
+}
+
+TEST(StreamLoaderTest, MissingFileThrows) {
+  s21::vector<Tick> ticks;
+  EXPECT_THROW(s21::load_records<Tick>("/nonexistent/s21_ticks.bin", ticks),
+               std::system_error);
+  EXPECT_THROW(s21::for_each_line("/nonexistent/s21.csv",
+                                  [](std::string_view) {}),
+               std::system_error);
+}
+
+TEST(StreamLoaderTest, PeakMemoryDoesNotDependOnFileSize) {
+  TempFile file(numbered_lines(200000));
+  s21::stream_options options;
+  options.buffer_bytes = 64 * 1024;
+  options.batch_size = 256;
+  s21::vector<std::pair<int, int>> v;
+  v.reserve(200000);
+  alloc_tracker::AllocScope scope;
+  s21::load_lines(file.path(), v, parse_pair, options);
+  EXPECT_EQ(v.size(), 200000UL);
+  // файл около 2.6 МБ, а кроме самого вектора живут только буфер чтения,
+  // пачка и остаток строки
+  EXPECT_LT(scope.stats().peak_live_bytes,
+            options.buffer_bytes + options.batch_size * sizeof(v[0]) + 1024);
+}
@@ -1,6 +1,22 @@
 #include "test_start.h"
 
+// После каждого теста печатает, сколько раз он обратился к куче
+class AllocReportListener : public ::testing::EmptyTestEventListener {
+  void OnTestStart(const ::testing::TestInfo &) override {
+    scope_ = alloc_tracker::AllocScope();
+  }
+  void OnTestEnd(const ::testing::TestInfo &) override {
+    alloc_tracker::AllocStats stats = scope_.stats();
+    printf("[  ALLOCS  ] %zu allocations, %zu bytes, peak %zu bytes live\n",
+           stats.allocations, stats.bytes, stats.peak_live_bytes);
+  }
+
+  alloc_tracker::AllocScope scope_;
+};
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
+  ::testing::UnitTest::GetInstance()->listeners().Append(
+      new AllocReportListener);
   return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
@@ -5,6 +5,7 @@
 
 
 #include "../containers.h"
+#include "alloc_tracker.h"
 
 
-#endif  
\ No newline at end of file
+#endif
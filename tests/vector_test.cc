@@ -1,5 +1,12 @@
 #include "test_start.h"
 
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
 TEST(VectorTest, Constructor_Default) {
   s21::vector<int> s21_vector;
   std::vector<int> std_vector;
@@ -102,8 +109,14 @@ TEST(VectorTest, IndexOperator_ValidIndex) {
 
 TEST(VectorTest, IndexOperator_InvalidIndex) {
   s21::vector<int> v = {1, 2, 3, 4, 5};
-  EXPECT_ANY_THROW(v[5]);
-  EXPECT_ANY_THROW(v[10]);
+#ifdef S21_HARDENED
+  EXPECT_DEATH(v[5], "index out of range");
+  EXPECT_DEATH(v[10], "index out of range");
+#else
+  // operator[] индекс не проверяет, проверка осталась в at()
+  EXPECT_ANY_THROW(v.at(5));
+  EXPECT_ANY_THROW(v.at(10));
+#endif
 }
 
 TEST(VectorTest, ConstIndexOperator_ValidIndex) {
@@ -224,8 +237,11 @@ TEST(VectorTest, Insert1){
 
 TEST(VectorExceptionsTest, AccessOutOfBounds) {
     s21::vector<int> myVector;
-    EXPECT_THROW(myVector[0], std::out_of_range);
-    ASSERT_THROW(myVector[0], std::out_of_range);
+#ifdef S21_HARDENED
+    EXPECT_DEATH(myVector[0], "index out of range");
+#endif
+    EXPECT_THROW(myVector.at(0), std::out_of_range);
+    ASSERT_THROW(myVector.at(0), std::out_of_range);
 }
 
 
@@ -246,3 +262,543 @@ TEST(VectorInsertTest, ReserveCalled) {
 }
 
 
+
+TEST(VectorTest, CustomAllocator) {
+  alloc_tracker::AllocStats stats;
+  alloc_tracker::counting_allocator<int> alloc(&stats);
+  {
+    s21::vector<int, alloc_tracker::counting_allocator<int>> v({1, 2}, alloc);
+    s21::vector<int, alloc_tracker::counting_allocator<int>> copy(v);
+    EXPECT_EQ(copy.get_allocator(), alloc);
+    EXPECT_EQ(copy[0], 1);
+    EXPECT_EQ(stats.allocations, 2UL);
+  }
+  EXPECT_EQ(stats.deallocations, stats.allocations);
+  EXPECT_EQ(stats.live_bytes, 0UL);
+}
+
+namespace {
+// Считает, сколько объектов создано, скопировано и перемещено
+struct Tracked {
+  static int constructed;
+  static int copied;
+  static int moved;
+  static int alive;
+  int value = 0;
+  Tracked() { constructed++, alive++; }
+  explicit Tracked(int v) : value(v) { constructed++, alive++; }
+  Tracked(const Tracked &other) : value(other.value) { copied++, alive++; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { moved++, alive++; }
+  Tracked &operator=(const Tracked &) = default;
+  ~Tracked() { alive--; }
+  static void reset() { constructed = copied = moved = alive = 0; }
+};
+int Tracked::constructed = 0;
+int Tracked::copied = 0;
+int Tracked::moved = 0;
+int Tracked::alive = 0;
+
+// То же, но перемещение может бросить, поэтому вектор обязан копировать
+struct ThrowingMove : Tracked {
+  using Tracked::Tracked;
+  ThrowingMove(const ThrowingMove &) = default;
+  ThrowingMove(ThrowingMove &&other) noexcept(false) : Tracked(other) {}
+};
+}  // namespace
+
+TEST(VectorTest, ReserveDoesNotConstruct) {
+  Tracked::reset();
+  {
+    s21::vector<Tracked> v;
+    v.reserve(1000);
+    EXPECT_EQ(Tracked::constructed, 0);
+    EXPECT_EQ(Tracked::alive, 0);
+    v.push_back(Tracked(1));
+    EXPECT_EQ(Tracked::alive, 1);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorTest, ReserveMovesElements) {
+  s21::vector<Tracked> v(4);
+  Tracked::reset();
+  v.reserve(100);
+  EXPECT_EQ(Tracked::moved, 4);
+  EXPECT_EQ(Tracked::copied, 0);
+  v.shrink_to_fit();
+  EXPECT_EQ(Tracked::moved, 8);
+  EXPECT_EQ(v.capacity(), 4UL);
+}
+
+TEST(VectorTest, ReserveCopiesThrowingMove) {
+  s21::vector<ThrowingMove> v(4);
+  Tracked::reset();
+  v.reserve(100);
+  EXPECT_EQ(Tracked::copied, 4);
+  EXPECT_EQ(Tracked::moved, 0);
+}
+
+TEST(VectorTest, MiddleInsertOfThrowingMoveKeepsCapacity) {
+  s21::vector<ThrowingMove> v(4);
+  v.reserve(64);
+  for (int i = 0; i < 40; i++) {
+    v.insert(v.begin() + 1, ThrowingMove(i));
+  }
+  // хвост не сдвигается на месте, но и емкость не растет с каждой вставкой
+  EXPECT_EQ(v.capacity(), 64UL);
+  EXPECT_EQ(v.size(), 44UL);
+  EXPECT_EQ(v[1].value, 39);
+  EXPECT_EQ(v[40].value, 0);
+
+  s21::vector<s21::vector<int>> nested;
+  for (int i = 0; i < 40; i++) {
+    nested.insert(nested.begin(), s21::vector<int>{i});
+  }
+  EXPECT_LE(nested.capacity(), 64UL);
+  EXPECT_EQ(nested[0][0], 39);
+  EXPECT_EQ(nested[39][0], 0);
+}
+
+static_assert(std::is_nothrow_move_constructible_v<s21::vector<int>>);
+
+TEST(VectorTest, NestedVectorsMoveOnGrowth) {
+  s21::vector<s21::vector<int>> rows;
+  rows.push_back(s21::vector<int>{1, 2, 3});
+  const int *first_row = rows[0].data();
+  for (int i = 0; i < 100; i++) {
+    rows.push_back(s21::vector<int>{i, i});
+  }
+  // внутренние буферы переехали вместе с векторами, а не скопировались
+  EXPECT_EQ(rows[0].data(), first_row);
+  EXPECT_EQ(rows[100][1], 99);
+}
+
+TEST(VectorTest, PopBackAndEraseDestroy) {
+  Tracked::reset();
+  {
+    s21::vector<Tracked> v(3);
+    EXPECT_EQ(Tracked::alive, 3);
+    v.pop_back();
+    EXPECT_EQ(Tracked::alive, 2);
+    v.erase(v.begin());
+    EXPECT_EQ(Tracked::alive, 1);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorTest, PushBackOwnElementWhileGrowing) {
+  s21::vector<std::string> v = {"first", "second"};
+  EXPECT_EQ(v.capacity(), v.size());
+  v.push_back(v[0]);
+  EXPECT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[2], "first");
+}
+
+TEST(VectorTest, EmplaceBackConstructsInPlace) {
+  s21::vector<Tracked> v;
+  v.reserve(2);
+  Tracked::reset();
+  Tracked &added = v.emplace_back(7);
+  EXPECT_EQ(added.value, 7);
+  EXPECT_EQ(Tracked::constructed, 1);
+  EXPECT_EQ(Tracked::copied + Tracked::moved, 0);
+}
+
+TEST(VectorTest, PushBackRvalueMoves) {
+  s21::vector<Tracked> v;
+  v.reserve(2);
+  Tracked value(3);
+  Tracked::reset();
+  v.push_back(std::move(value));
+  EXPECT_EQ(Tracked::moved, 1);
+  EXPECT_EQ(Tracked::copied, 0);
+  EXPECT_EQ(v.back().value, 3);
+}
+
+TEST(VectorTest, MoveOnlyElements) {
+  s21::vector<std::unique_ptr<int>> v;
+  for (int i = 0; i < 100; i++) {
+    v.push_back(std::make_unique<int>(i));
+  }
+  v.emplace_back(new int(100));
+  EXPECT_EQ(v.size(), 101UL);
+  EXPECT_EQ(*v[50], 50);
+  EXPECT_EQ(*v[100], 100);
+}
+
+TEST(VectorTest, GeometricGrowth) {
+  s21::vector<int> v;
+  size_t reallocations = 0;
+  size_t capacity = v.capacity();
+  for (int i = 0; i < 100000; i++) {
+    v.push_back(i);
+    if (v.capacity() != capacity) {
+      EXPECT_GE(v.capacity() * S21_VECTOR_GROWTH_DEN,
+                capacity * S21_VECTOR_GROWTH_NUM);
+      capacity = v.capacity();
+      reallocations++;
+    }
+  }
+  EXPECT_LE(reallocations, 40UL);
+  EXPECT_EQ(v[99999], 99999);
+}
+
+TEST(VectorTest, PushBackAllocations) {
+  alloc_tracker::AllocScope scope;
+  s21::vector<int> v;
+  for (int i = 0; i < 1000000; i++) {
+    v.push_back(i);
+  }
+  EXPECT_LE(scope.stats().allocations, 40UL);
+}
+
+namespace {
+// Владеет памятью в куче, но не хранит указателей на себя, поэтому его
+// можно переносить побайтово
+struct Relocatable {
+  explicit Relocatable(int v, int *destroyed)
+      : value(new int(v)), destroyed_(destroyed) {}
+  Relocatable(Relocatable &&other) noexcept
+      : value(other.value), destroyed_(other.destroyed_) {
+    other.value = nullptr;
+  }
+  Relocatable &operator=(Relocatable &&other) noexcept {
+    std::swap(value, other.value);
+    return *this;
+  }
+  ~Relocatable() {
+    if (value != nullptr) {
+      ++*destroyed_;
+      delete value;
+    }
+  }
+  int *value;
+  int *destroyed_;
+};
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<Relocatable> : std::true_type {};
+
+TEST(VectorTest, TriviallyRelocatableGrowth) {
+  int destroyed = 0;
+  {
+    s21::vector<Relocatable> v;
+    for (int i = 0; i < 100; i++) {
+      v.emplace_back(i, &destroyed);
+    }
+    v.erase(v.begin() + 10);
+    EXPECT_EQ(destroyed, 1);
+    v.shrink_to_fit();
+    EXPECT_EQ(destroyed, 1);
+    EXPECT_EQ(*v[10].value, 11);
+    EXPECT_EQ(*v[98].value, 99);
+  }
+  EXPECT_EQ(destroyed, 100);
+}
+
+TEST(VectorTest, MallocAllocatorReallocates) {
+  s21::vector<int, s21::malloc_allocator<int>> v;
+  std::vector<int> expected;
+  for (int i = 0; i < 10000; i++) {
+    v.push_back(i);
+    expected.push_back(i);
+  }
+  v.push_back(v[0]);
+  expected.push_back(expected[0]);
+  v.insert(v.begin() + 5000, -1);
+  expected.insert(expected.begin() + 5000, -1);
+  v.erase(v.begin() + 17);
+  expected.erase(expected.begin() + 17);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(v[i], expected[i]);
+  }
+}
+
+TEST(VectorTest, AlignedAllocator) {
+  for (std::size_t n : {1, 3, 17, 1000}) {
+    s21::aligned_vector<char, 64> v(n);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 64, 0UL);
+  }
+  s21::aligned_vector<double, 32> v;
+  alloc_tracker::AllocScope scope;
+  for (int i = 0; i < 100; i++) {
+    v.push_back(i);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 32, 0UL);
+  }
+  EXPECT_EQ(v[99], 99);
+  EXPECT_GT(scope.stats().allocations, 0UL);
+}
+
+TEST(VectorTest, HugePageAllocatorGrows) {
+  // порог 4 КиБ, чтобы пройти и мелкие блоки, и mmap, и mremap
+  using allocator = s21::huge_page_allocator<int, 64, 4096>;
+  s21::vector<int, allocator> v;
+  std::vector<int> expected;
+  for (int i = 0; i < 300000; i++) {
+    v.push_back(i);
+    expected.push_back(i);
+    if (v.size() == 2000) {
+      EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) %
+                    allocator::kHugePageBytes,
+                0UL);
+    }
+  }
+  v.insert(v.begin() + 7, -1);
+  expected.insert(expected.begin() + 7, -1);
+  v.erase(v.begin() + 100, v.begin() + 250000);
+  expected.erase(expected.begin() + 100, expected.begin() + 250000);
+  v.shrink_to_fit();
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(v[i], expected[i]);
+  }
+}
+
+TEST(VectorTest, HugePageReallocateKeepsAlignment) {
+  using allocator = s21::huge_page_allocator<int, 64, 4096>;
+  constexpr std::size_t kStep = allocator::kHugePageBytes / sizeof(int);
+  allocator alloc;
+  int *p = alloc.allocate(kStep);
+  p[0] = 1;
+  p[kStep - 1] = 2;
+  std::size_t n = kStep;
+  for (int i = 0; i < 6; i++) {
+    // соседнее отображение не дает расти на месте, блоку приходится переезжать
+    int *neighbour = alloc.allocate(kStep);
+    int *q = alloc.reallocate(p, n, n + kStep);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(q) % allocator::kHugePageBytes,
+              0UL);
+    EXPECT_EQ(q[0], 1);
+    EXPECT_EQ(q[kStep - 1], 2);
+    q[n + kStep - 1] = 3;
+    alloc.deallocate(neighbour, kStep);
+    p = q;
+    n += kStep;
+  }
+  EXPECT_EQ(p[n - 1], 3);
+  alloc.deallocate(p, n);
+}
+
+TEST(VectorTest, HugePageAllocatorNonTrivial) {
+  s21::vector<std::string,
+              s21::huge_page_allocator<std::string, 64, 4096>>
+      v;
+  for (int i = 0; i < 1000; i++) {
+    v.push_back(std::to_string(i) + " is long enough to avoid SSO");
+  }
+  EXPECT_EQ(v[999], "999 is long enough to avoid SSO");
+  v.clear();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 0UL);
+}
+
+TEST(VectorTest, EraseShiftsTail) {
+  s21::vector<int> v = {1, 2, 3, 4, 5};
+  v.erase(v.begin() + 1);
+  v.erase(v.begin() + 3);
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[1], 3);
+  EXPECT_EQ(v[2], 4);
+}
+
+TEST(VectorTest, InsertInPlace) {
+  s21::vector<int> v = {1, 2, 3, 4};
+  v.reserve(16);
+  const int *data = v.data();
+  alloc_tracker::AllocScope scope;
+  v.insert(v.begin() + 1, 10);
+  v.insert(v.end(), 20);
+  v.insert(v.begin(), 30);
+  EXPECT_EQ(scope.stats().allocations, 0UL);
+  EXPECT_EQ(v.data(), data);
+  EXPECT_EQ(v.capacity(), 16UL);
+  std::vector<int> expected = {30, 1, 10, 2, 3, 4, 20};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(v[i], expected[i]);
+  }
+}
+
+TEST(VectorTest, RangeInsert) {
+  s21::vector<std::string> v = {"a", "b", "c"};
+  std::vector<std::string> expected = {"a", "b", "c"};
+  std::list<std::string> words = {"x", "y", "z"};
+
+  auto it = v.insert(v.begin() + 1, words.begin(), words.end());
+  expected.insert(expected.begin() + 1, words.begin(), words.end());
+  EXPECT_EQ(*it, "x");
+  v.insert(v.begin() + 2, 3, std::string("n"));
+  expected.insert(expected.begin() + 2, 3, std::string("n"));
+  v.insert(v.end(), {"p", "q"});
+  expected.insert(expected.end(), {"p", "q"});
+
+  std::istringstream input("i j");
+  v.insert(v.begin(), std::istream_iterator<std::string>(input),
+           std::istream_iterator<std::string>());
+  expected.insert(expected.begin(), {"i", "j"});
+
+  it = v.insert_many(v.begin() + 4, "m1", std::string("m2"));
+  expected.insert(expected.begin() + 4, {"m1", "m2"});
+  EXPECT_EQ(*it, "m1");
+  v.insert_many_back("last");
+  expected.push_back("last");
+
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(v[i], expected[i]);
+  }
+  EXPECT_THROW(v.insert(v.end() + 1, 2, std::string("bad")),
+               std::out_of_range);
+}
+
+TEST(VectorTest, RangeInsertShiftsOnce) {
+  Tracked::reset();
+  {
+    s21::vector<Tracked> v;
+    v.reserve(20);
+    for (int i = 0; i < 10; i++) {
+      v.emplace_back(i);
+    }
+    Tracked::reset();
+    Tracked fill(-1);
+    v.insert(v.begin(), 5, fill);
+    // каждый из 10 старых элементов переехал ровно один раз
+    EXPECT_EQ(Tracked::moved, 10);
+    EXPECT_EQ(Tracked::copied, 5);
+    EXPECT_EQ(v[4].value, -1);
+    EXPECT_EQ(v[5].value, 0);
+    EXPECT_EQ(v[14].value, 9);
+  }
+}
+
+TEST(VectorTest, InsertOwnElement) {
+  s21::vector<std::string> v = {"zero", "one", "two"};
+  v.reserve(10);
+  v.insert(v.begin(), v[2]);
+  v.insert(v.begin(), 2, v[3]);
+  v.emplace(v.begin() + 1, v.back());
+  std::vector<std::string> expected = {"two", "two", "two",
+                                       "two", "zero", "one", "two"};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(v[i], expected[i]);
+  }
+
+  s21::vector<std::string> full = {"a", "b"};
+  full.shrink_to_fit();
+  full.insert(full.begin(), full[1]);
+  full.resize(5, full[0]);
+  EXPECT_EQ(full[0], "b");
+  EXPECT_EQ(full[4], "b");
+}
+
+namespace {
+// Копирование бросает, когда счетчик доходит до нуля
+struct FailingCopy {
+  static int copies_left;
+  std::string value;
+  explicit FailingCopy(std::string v) : value(std::move(v)) {}
+  FailingCopy(const FailingCopy &other) : value(other.value) {
+    if (--copies_left == 0) {
+      throw std::runtime_error("copy failed");
+    }
+  }
+  FailingCopy(FailingCopy &&other) noexcept = default;
+  FailingCopy &operator=(FailingCopy &&other) noexcept = default;
+};
+int FailingCopy::copies_left = 0;
+}  // namespace
+
+TEST(VectorTest, FailedInsertKeepsElements) {
+  s21::vector<FailingCopy> v;
+  v.reserve(10);
+  v.emplace_back("a");
+  v.emplace_back("b");
+  v.emplace_back("c");
+  FailingCopy value("x");
+  FailingCopy::copies_left = 3;
+  EXPECT_THROW(v.insert(v.begin() + 1, 4, value), std::runtime_error);
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[0].value, "a");
+  EXPECT_EQ(v[1].value, "b");
+  EXPECT_EQ(v[2].value, "c");
+
+  FailingCopy::copies_left = 2;
+  EXPECT_THROW(v.insert(v.begin(), 20, value), std::runtime_error);
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[0].value, "a");
+  EXPECT_EQ(v.capacity(), 10UL);
+}
+
+TEST(VectorTest, EraseRange) {
+  s21::vector<std::string> v = {"0", "1", "2", "3", "4", "5"};
+  auto it = v.erase(v.begin() + 1, v.begin() + 4);
+  EXPECT_EQ(*it, "4");
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[0], "0");
+  EXPECT_EQ(v[2], "5");
+  it = v.erase(v.begin() + 1, v.end());
+  EXPECT_EQ(it, v.end());
+  EXPECT_EQ(v.size(), 1UL);
+  EXPECT_EQ(v.erase(v.begin(), v.begin()), v.begin());
+  EXPECT_THROW(v.erase(v.begin(), v.end() + 1), std::out_of_range);
+
+  s21::vector<int> ints = {1, 2, 3, 4, 5};
+  ints.erase(ints.begin(), ints.begin() + 2);
+  EXPECT_EQ(ints[0], 3);
+  EXPECT_EQ(ints.size(), 3UL);
+}
+
+TEST(VectorTest, AssignAndResize) {
+  s21::vector<std::string> v = {"a", "b"};
+  v.assign(3, "c");
+  ASSERT_EQ(v.size(), 3UL);
+  EXPECT_EQ(v[2], "c");
+  v.assign({"d", "e"});
+  ASSERT_EQ(v.size(), 2UL);
+  EXPECT_EQ(v[1], "e");
+  v.assign(4, v[0]);
+  EXPECT_EQ(v[3], "d");
+
+  v.resize(6);
+  ASSERT_EQ(v.size(), 6UL);
+  EXPECT_EQ(v[5], "");
+  v.resize(2);
+  EXPECT_EQ(v.size(), 2UL);
+  v.resize(4, "f");
+  EXPECT_EQ(v[3], "f");
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(VectorTest, RandomInsertEraseMatchesStd) {
+  s21::vector<std::string> v;
+  std::vector<std::string> expected;
+  unsigned seed = 12345;
+  auto next = [&seed] {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7fff;
+  };
+  for (int step = 0; step < 2000; step++) {
+    size_t pos = expected.empty() ? 0 : next() % (expected.size() + 1);
+    size_t count = next() % 4;
+    std::string value = std::to_string(step);
+    if (next() % 3 == 0 && !expected.empty()) {
+      size_t last = std::min(expected.size(), pos + count);
+      pos = std::min(pos, last);
+      v.erase(v.begin() + pos, v.begin() + last);
+      expected.erase(expected.begin() + pos, expected.begin() + last);
+    } else {
+      v.insert(v.begin() + pos, count, value);
+      expected.insert(expected.begin() + pos, count, value);
+    }
+  }
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(v[i], expected[i]);
+  }
+}